@@ -0,0 +1,51 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "Animation/Animation.h"
+#include "Resource/ImageFrame.h"
+#include "Sequence.h"
+#include "Sprite.h"
+#include "Texture.h"
+
+namespace FA {
+
+namespace Shared {
+
+namespace {
+
+constexpr float switchTime = 0.1f;
+constexpr float deltaTime = 1.0f / 60.0f;
+constexpr int nFrames = 4;
+
+}  // namespace
+
+static void BM_AnimationApplyTo(benchmark::State& state)
+{
+    Graphic::Texture texture;
+    Graphic::Sprite sprite;
+    auto seq = std::make_shared<Sequence<ImageFrame>>(switchTime);
+    for (int i = 0; i < nFrames; i++) {
+        seq->Add({&texture, {i * 16, 0, 16, 16}, {8.0f, 8.0f}});
+    }
+    Animation<ImageFrame> animation(seq, state.range(0) != 0);
+    animation.Start();
+
+    for (auto _ : state) {
+        animation.Update(deltaTime);
+        animation.ApplyTo(sprite);
+        benchmark::ClobberMemory();
+    }
+}
+// arg: center origin
+BENCHMARK(BM_AnimationApplyTo)->Arg(0)->Arg(1);
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -0,0 +1,63 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include "Body.h"
+#include "EntityIf.h"
+#include "RectangleShapeIf.h"
+#include "Shape.h"
+
+namespace FA {
+
+namespace Entity {
+
+// Entity with a single collider, collision handling is left empty
+class BenchEntity : public EntityIf
+{
+public:
+    BenchEntity(EntityId id, const sf::Vector2f& position, const sf::Vector2f& size, bool isStatic)
+        : id_(id)
+        , isStatic_(isStatic)
+        , shape_(body_)
+    {
+        body_.position_ = position;
+        auto collider = shape_.RegisterCollider(Shape::ColliderType::Entity);
+        collider->setSize(size);
+        shape_.Enter();
+    }
+
+    virtual EntityType Type() const override { return EntityType::Unknown; }
+    virtual LayerType GetLayer() const override { return LayerType::Ground; }
+    virtual bool IsStatic() const override { return isStatic_; }
+    virtual bool IsSolid() const override { return true; }
+
+    virtual void Destroy() override {}
+    virtual void Init() override {}
+    virtual void Update(float deltaTime) override {}
+    virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) const override {}
+    virtual bool Intersect(const EntityIf& otherEntity) const override
+    {
+        return shape_.Intersect(static_cast<const BenchEntity&>(otherEntity).shape_);
+    }
+    virtual bool IsOutsideTileMap(const sf::FloatRect& rect) const override { return false; }
+    virtual sf::FloatRect GetBounds() const override { return shape_.GetBounds(); }
+    virtual void HandleCollision(const EntityId id) override {}
+    virtual void HandleOutsideTileMap() override {}
+    virtual EntityId GetId() const override { return id_; }
+
+    const Shape& GetShape() const { return shape_; }
+
+private:
+    EntityId id_{};
+    bool isStatic_{};
+    Body body_;
+    Shape shape_;
+};
+
+}  // namespace Entity
+
+}  // namespace FA
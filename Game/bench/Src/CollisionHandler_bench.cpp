@@ -0,0 +1,61 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "BenchEntity.h"
+#include "CollisionHandler.h"
+#include "EntityDb.h"
+
+namespace FA {
+
+namespace Entity {
+
+namespace {
+
+// same size as levelCollider.tmx
+constexpr float mapSize = 1600.0f;
+constexpr float entitySize = 16.0f;
+constexpr unsigned int seed = 1;
+
+}  // namespace
+
+// arg 0: number of moving entities, arg 1: number of static entities
+static void BM_CollisionHandlerDetectCollisions(benchmark::State& state)
+{
+    EntityDb entityDb;
+    CollisionHandler collisionHandler(entityDb);
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<float> dist(0.0f, mapSize - entitySize);
+    auto nEntities = state.range(0);
+    auto nStaticEntities = state.range(1);
+
+    for (EntityId id = 0; id < nEntities + nStaticEntities; id++) {
+        sf::Vector2f position(dist(engine), dist(engine));
+        bool isStatic = id >= nEntities;
+        entityDb.AddEntity(std::make_unique<BenchEntity>(id, position, sf::Vector2f(entitySize, entitySize), isStatic));
+        collisionHandler.AddCollider(id);
+    }
+
+    for (auto _ : state) {
+        collisionHandler.DetectCollisions();
+        // clears detected pairs, handlers are empty
+        collisionHandler.HandleCollisions();
+    }
+}
+BENCHMARK(BM_CollisionHandlerDetectCollisions)
+    ->Args({16, 16})
+    ->Args({64, 64})
+    ->Args({256, 64})
+    ->Args({1024, 64})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace Entity
+
+}  // namespace FA
@@ -0,0 +1,55 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "Level.h"
+#include "Message/MessageBus.h"
+#include "RecordingRenderTarget.h"
+#include "Resource/TextureManager.h"
+#include "Screen.h"
+#include "Texture.h"
+
+namespace FA {
+
+namespace World {
+
+namespace {
+
+constexpr float deltaTime = 1.0f / 60.0f;
+
+}  // namespace
+
+// Builds the draw list of one frame, nothing is rendered. Run from the folder containing assets
+static void BM_LevelDraw(benchmark::State& state)
+{
+    Shared::MessageBus messageBus;
+    Shared::TextureManager textureManager([]() { return std::make_unique<Graphic::Texture>(); });
+    Level level(messageBus, textureManager, {Shared::Screen::width, Shared::Screen::height});
+    level.Load("levelCollider.tmx");
+    level.Create();
+    // entities are created from the creation pool
+    level.Update(deltaTime);
+
+    Graphic::RecordingRenderTarget renderTarget;
+    for (auto _ : state) {
+        renderTarget.Clear();
+        level.Draw(renderTarget);
+        benchmark::ClobberMemory();
+    }
+
+    using CommandType = Graphic::RecordingRenderTarget::CommandType;
+    state.counters["draw_calls"] = static_cast<double>(renderTarget.GetNumberOfDrawCalls());
+    state.counters["batches"] = static_cast<double>(renderTarget.GetNumberOfDrawCalls(CommandType::Batch));
+    state.counters["texture_switches"] = static_cast<double>(renderTarget.GetNumberOfTextureSwitches());
+}
+BENCHMARK(BM_LevelDraw)->Unit(benchmark::kMicrosecond);
+
+}  // namespace World
+
+}  // namespace FA
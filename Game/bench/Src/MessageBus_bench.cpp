@@ -0,0 +1,42 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "Message/BroadcastMessage/IsKeyPressedMessage.h"
+#include "Message/MessageBus.h"
+#include "Message/MessageType.h"
+
+namespace FA {
+
+namespace Shared {
+
+// arg: number of subscribers for the sent message type
+static void BM_MessageBusSendMessage(benchmark::State& state)
+{
+    MessageBus messageBus;
+    int nReceived = 0;
+    for (int i = 0; i < state.range(0); i++) {
+        messageBus.AddSubscriber("subscriber" + std::to_string(i), MessageType::IsKeyPressed,
+                                 [&nReceived](std::shared_ptr<Message> msg) { nReceived++; });
+    }
+
+    for (auto _ : state) {
+        auto msg = std::make_shared<IsKeyPressedMessage>(sf::Keyboard::Key::Space);
+        messageBus.SendMessage(msg);
+    }
+
+    benchmark::DoNotOptimize(nReceived);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MessageBusSendMessage)->RangeMultiplier(4)->Range(1, 256);
+
+}  // namespace Shared
+
+}  // namespace FA
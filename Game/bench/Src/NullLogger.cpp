@@ -0,0 +1,37 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "NullLogger.h"
+
+namespace FA {
+
+namespace {
+
+Util::NullLogger nullLogger;
+
+}  // namespace
+
+// Substitute the loggers during link time, so file logging doesn't end up in the measurements
+
+namespace Shared {
+
+Util::LoggerIf& Logger()
+{
+    return nullLogger;
+}
+
+}  // namespace Shared
+
+namespace Tile {
+
+Util::LoggerIf& Logger()
+{
+    return nullLogger;
+}
+
+}  // namespace Tile
+
+}  // namespace FA
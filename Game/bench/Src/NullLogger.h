@@ -0,0 +1,28 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include "LoggerIf.h"
+
+namespace FA {
+
+namespace Util {
+
+class NullLogger : public LoggerIf
+{
+public:
+    virtual void OpenLog(const std::string& folder, const std::string& fileName, bool toConsole) override {}
+    virtual void CloseLog() override {}
+    virtual void MakeDebugLogEntry(const std::string& fn, const std::string& str) override {}
+    virtual void MakeInfoLogEntry(const std::string& fn, const std::string& str) override {}
+    virtual void MakeWarnLogEntry(const std::string& fn, const std::string& str) override {}
+    virtual void MakeErrorLogEntry(const std::string& fn, const std::string& str) override {}
+};
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,47 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Resource/ResourceManager.h"
+
+namespace FA {
+
+namespace Shared {
+
+namespace {
+
+struct SomeResource
+{
+    bool loadFromFile(const std::string& path) { return true; }
+};
+
+}  // namespace
+
+// arg: number of loaded resources
+static void BM_ResourceManagerGet(benchmark::State& state)
+{
+    ResourceManager<SomeResource> resourceManager([]() { return std::make_unique<SomeResource>(); });
+    std::vector<ResourceId> ids;
+    for (int i = 0; i < state.range(0); i++) {
+        ids.push_back(resourceManager.Load("assets/resource" + std::to_string(i) + ".png"));
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(resourceManager.Get(ids[i]));
+        i = (i + 1) % ids.size();
+    }
+}
+BENCHMARK(BM_ResourceManagerGet)->Arg(1)->Arg(16)->Arg(256);
+
+}  // namespace Shared
+
+}  // namespace FA
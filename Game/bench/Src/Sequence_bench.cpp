@@ -0,0 +1,54 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "Sequence.h"
+
+namespace FA {
+
+namespace Shared {
+
+namespace {
+
+constexpr float switchTime = 0.1f;
+constexpr float deltaTime = 1.0f / 60.0f;
+
+}  // namespace
+
+static void BM_SequenceUpdate(benchmark::State& state)
+{
+    Sequence<int> seq(switchTime);
+    for (int i = 0; i < state.range(0); i++) {
+        seq.Add(i);
+    }
+    seq.Start();
+
+    for (auto _ : state) {
+        seq.Update(deltaTime);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_SequenceUpdate)->Arg(1)->Arg(4)->Arg(16);
+
+static void BM_SequenceGetCurrent(benchmark::State& state)
+{
+    Sequence<int> seq(switchTime);
+    for (int i = 0; i < state.range(0); i++) {
+        seq.Add(i);
+    }
+    seq.Start();
+
+    for (auto _ : state) {
+        seq.Update(deltaTime);
+        benchmark::DoNotOptimize(seq.GetCurrent());
+    }
+}
+BENCHMARK(BM_SequenceGetCurrent)->Arg(1)->Arg(4)->Arg(16);
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -0,0 +1,30 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "BenchEntity.h"
+
+namespace FA {
+
+namespace Entity {
+
+// arg: 1 if the shapes overlap
+static void BM_ShapeIntersect(benchmark::State& state)
+{
+    sf::Vector2f offset = state.range(0) != 0 ? sf::Vector2f(8.0f, 8.0f) : sf::Vector2f(64.0f, 64.0f);
+    BenchEntity entity(0, {0.0f, 0.0f}, {16.0f, 16.0f}, false);
+    BenchEntity otherEntity(1, offset, {16.0f, 16.0f}, false);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(entity.GetShape().Intersect(otherEntity.GetShape()));
+    }
+}
+BENCHMARK(BM_ShapeIntersect)->Arg(0)->Arg(1);
+
+}  // namespace Entity
+
+}  // namespace FA
@@ -0,0 +1,48 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Resource/SheetItem.h"
+#include "Resource/SheetManager.h"
+#include "Resource/SpriteSheet.h"
+
+namespace FA {
+
+namespace Shared {
+
+namespace {
+
+const std::string sheetPath = "assets/tiny-RPG-forest-files/PNG/environment/tileset";
+
+}  // namespace
+
+// arg: number of sheets, keys are paths like the ones TileMap registers
+static void BM_SheetManagerGetTextureRect(benchmark::State& state)
+{
+    SheetManager sheetManager;
+    std::vector<SheetItem> items;
+    for (int i = 0; i < state.range(0); i++) {
+        auto name = sheetPath + std::to_string(i) + ".png";
+        sheetManager.AddSheet(name, std::make_unique<SpriteSheet>(i, sf::Vector2u(544, 512), sf::Vector2u(34, 32)));
+        items.push_back({name, {static_cast<unsigned int>(i % 34), static_cast<unsigned int>(i % 32)}});
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sheetManager.GetTextureRect(items[i]));
+        i = (i + 1) % items.size();
+    }
+}
+BENCHMARK(BM_SheetManagerGetTextureRect)->Arg(1)->Arg(16)->Arg(128);
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -0,0 +1,63 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <tinyxml2/tinyxml2.h>
+
+#include "ByteStreamFactory.h"
+#include "Folder.h"
+#include "ParseHelper.h"
+#include "TileService.h"
+#include "TileSetFactory.h"
+#include "TmxParser.h"
+#include "TsxParser.h"
+
+namespace FA {
+
+namespace Tile {
+
+namespace {
+
+using ParseHelperImpl = ParseHelper<tinyxml2::XMLElement, tinyxml2::XMLError>;
+using TileServiceImpl = TileService<tinyxml2::XMLDocument, tinyxml2::XMLElement, tinyxml2::XMLError>;
+using TmxParserImpl = TmxParser<tinyxml2::XMLDocument, tinyxml2::XMLElement, tinyxml2::XMLError>;
+using TsxParserImpl = TsxParser<tinyxml2::XMLDocument, tinyxml2::XMLElement, tinyxml2::XMLError>;
+
+}  // namespace
+
+// Layer csv is parsed in ReadLayers, run from the folder containing assets
+static void BM_TileServiceParseData(benchmark::State& state)
+{
+    auto helper = std::make_shared<ParseHelperImpl>();
+    TileServiceImpl tileService(std::make_unique<TmxParserImpl>(helper), std::make_unique<TsxParserImpl>(helper),
+                                std::make_unique<TileSetFactory>(), std::make_unique<Util::ByteStreamFactory>());
+
+    if (!tileService.Parse(Util::GetAssetsPath() + "/map/levelCollider.tmx")) {
+        state.SkipWithError("Could not parse levelCollider.tmx");
+        return;
+    }
+
+    std::size_t nTiles = 0;
+    for (auto _ : state) {
+        auto layers = tileService.ReadLayers();
+        nTiles = 0;
+        for (const auto& layer : layers) {
+            nTiles += layer.tileIds_.size();
+        }
+        benchmark::DoNotOptimize(layers);
+    }
+
+    state.SetItemsProcessed(state.iterations() * nTiles);
+}
+BENCHMARK(BM_TileServiceParseData)->Unit(benchmark::kMicrosecond);
+
+}  // namespace Tile
+
+}  // namespace FA
@@ -0,0 +1,12 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <benchmark/benchmark.h>
+
+// Compare runs between commits with:
+// bench --benchmark_out=result.json --benchmark_out_format=json
+// python 3rdparty/submodules/benchmark/tools/compare.py benchmarks base.json result.json
+BENCHMARK_MAIN();
@@ -0,0 +1,49 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Level.h"
+#include "Logging.h"
+
+namespace {
+
+const std::vector<std::string> defaultLevels = {"levelCollider.tmx"};
+
+}  // namespace
+
+// usage: cook [level]...
+// run from the folder containing assets, writes a cooked package next to each map which Level::Load then prefers.
+// A package is not read once its map or an image has changed, run again after editing them. Tile sets are not
+// checked, run again or delete the package after editing one.
+int main(int argc, char* argv[])
+{
+    using namespace FA;
+
+    std::vector<std::string> levels;
+    for (int i = 1; i < argc; i++) {
+        levels.push_back(argv[i]);
+    }
+    if (levels.empty()) levels = defaultLevels;
+
+    int result = EXIT_SUCCESS;
+    try {
+        for (const auto& level : levels) {
+            bool ok = World::Level::Cook(level);
+            std::cout << (ok ? "Cooked " : "Failed to cook ") << level << std::endl;
+            if (!ok) result = EXIT_FAILURE;
+        }
+    }
+    catch (const std::exception& e) {
+        LOG_ERROR("Exception catched: %s", e.what());
+        return EXIT_FAILURE;
+    }
+
+    return result;
+}
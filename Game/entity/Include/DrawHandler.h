@@ -10,6 +10,7 @@
 
 #include "Id.h"
 #include "LayerType.h"
+#include "SfmlFwd.h"
 
 namespace FA {
 
@@ -31,7 +32,7 @@ public:
 
     void AddDrawable(EntityId id);
     void RemoveDrawable(EntityId id);
-    void DrawTo(Graphic::RenderTargetIf &renderTarget) const;
+    void DrawTo(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &viewRect) const;
 
 private:
     struct DrawableInfo
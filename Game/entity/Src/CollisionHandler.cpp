@@ -11,6 +11,7 @@
 
 #include "EntityDb.h"
 #include "EntityIf.h"
+#include "Profiler.h"
 
 namespace FA {
 
@@ -50,6 +51,7 @@ void CollisionHandler::RemoveCollider(EntityId id)
 
 void CollisionHandler::DetectCollisions()
 {
+    PROFILE_SCOPE("CollisionHandler::DetectCollisions");
     for (const auto id : entities_) {
         DetectEntityCollisions(id);
         DetectStaticCollisions(id);
@@ -101,6 +103,7 @@ void CollisionHandler::DetectCollision(EntityId id, EntityId otherId)
 
 void CollisionHandler::HandleCollisions()
 {
+    PROFILE_SCOPE("CollisionHandler::HandleCollisions");
     for (const auto &pair : collisionPairs_) {
         auto &first = entityDb_.GetEntity(pair.first);
         auto &second = entityDb_.GetEntity(pair.second);
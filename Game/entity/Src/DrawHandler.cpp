@@ -8,8 +8,11 @@
 
 #include <sstream>
 
+#include <SFML/Graphics/Rect.hpp>
+
 #include "EntityDb.h"
 #include "EntityIf.h"
+#include "Profiler.h"
 
 namespace FA {
 
@@ -40,11 +43,12 @@ void DrawHandler::RemoveDrawable(EntityId id)
     }
 }
 
-void DrawHandler::DrawTo(Graphic::RenderTargetIf &renderTarget) const
+void DrawHandler::DrawTo(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &viewRect) const
 {
-    for (auto p : drawables_) {
-        auto id = p.second.id_;
-        entityDb_.GetEntity(id).DrawTo(renderTarget);
+    PROFILE_SCOPE("DrawHandler::DrawTo");
+    for (const auto &p : drawables_) {
+        const auto &entity = entityDb_.GetEntity(p.second.id_);
+        if (entity.GetBounds().intersects(viewRect)) entity.DrawTo(renderTarget);
     }
 }
 
@@ -128,8 +128,8 @@ void ArrowEntity::RegisterStates(std::shared_ptr<State> idleState, std::shared_p
 
     auto moveState = RegisterState(StateType::Move);
     auto imageAnimation = service_->CreateImageAnimation(images);
-    auto sprite = moveState->RegisterSprite();
-    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame>>(*sprite, imageAnimation);
+    auto& sprite = moveState->RegisterSprite();
+    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame>>(sprite, imageAnimation);
     moveState->RegisterImageAnimator(imageAnimator);
     auto colliderAnimation = service_->CreateColliderAnimation(colliders);
     auto rect = moveState->RegisterCollider(Shape::ColliderType::Entity);
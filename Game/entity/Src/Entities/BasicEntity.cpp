@@ -88,6 +88,11 @@ bool BasicEntity::IsOutsideTileMap(const sf::FloatRect& rect) const
     return !rect.contains(body_.position_);
 }
 
+sf::FloatRect BasicEntity::GetBounds() const
+{
+    return stateMachine_.GetShape().GetBounds();
+}
+
 void BasicEntity::HandleCollision(const EntityId id)
 {
     HandleEvent(std::make_shared<CollisionEvent>(id));
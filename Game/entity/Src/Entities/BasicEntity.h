@@ -46,6 +46,7 @@ public:
     void DrawTo(Graphic::RenderTargetIf& renderTarget) const final;
     bool Intersect(const EntityIf& otherEntity) const final;
     bool IsOutsideTileMap(const sf::FloatRect& rect) const final;
+    sf::FloatRect GetBounds() const final;
     void HandleCollision(const EntityId id) final;
     void HandleOutsideTileMap() final;
     EntityId GetId() const final { return id_; }
@@ -52,8 +52,8 @@ void CoinEntity::RegisterStates(std::shared_ptr<State> idleState, std::shared_pt
                                 const Shared::EntityData& data)
 {
     auto imageAnimation = service_->CreateImageAnimation(idleImages);
-    auto sprite = idleState->RegisterSprite();
-    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame>>(*sprite, imageAnimation);
+    auto& sprite = idleState->RegisterSprite();
+    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame>>(sprite, imageAnimation);
     idleState->RegisterImageAnimator(imageAnimator);
     auto colliderAnimation = service_->CreateColliderAnimation(idleColliders);
     auto rect = idleState->RegisterCollider(Shape::ColliderType::Entity);
@@ -157,7 +157,7 @@ void MoleEntity::RegisterStates(std::shared_ptr<State> idleState, std::shared_pt
 
 void MoleEntity::DefineIdleState(std::shared_ptr<State> state)
 {
-    auto sprite = state->RegisterSprite();
+    auto& sprite = state->RegisterSprite();
     FaceDirection* dir = nullptr;
     propertyStore_.GetPtr("FaceDirection", dir);
     std::initializer_list<ImageSelection> imageSelections{
@@ -165,7 +165,7 @@ void MoleEntity::DefineIdleState(std::shared_ptr<State> state)
         {FaceDirection::Right, service_->CreateImageAnimation(idleRightImages)},
         {FaceDirection::Front, service_->CreateImageAnimation(idleFrontImages)},
         {FaceDirection::Back, service_->CreateImageAnimation(idleBackImages)}};
-    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(*sprite, imageSelections, *dir);
+    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(sprite, imageSelections, *dir);
     state->RegisterImageAnimator(imageAnimator);
     auto rect = state->RegisterCollider(Shape::ColliderType::Entity);
     std::initializer_list<ColliderSelection> colliderSelections{
@@ -189,7 +189,7 @@ void MoleEntity::DefineIdleState(std::shared_ptr<State> state)
 
 void MoleEntity::DefineMoveState(std::shared_ptr<State> state)
 {
-    auto sprite = state->RegisterSprite();
+    auto& sprite = state->RegisterSprite();
     FaceDirection* dir = nullptr;
     propertyStore_.GetPtr("FaceDirection", dir);
     std::initializer_list<ImageSelection> imageSelections{
@@ -197,7 +197,7 @@ void MoleEntity::DefineMoveState(std::shared_ptr<State> state)
         {FaceDirection::Right, service_->CreateImageAnimation(walkRightImages)},
         {FaceDirection::Front, service_->CreateImageAnimation(walkFrontImages)},
         {FaceDirection::Back, service_->CreateImageAnimation(walkBackImages)}};
-    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(*sprite, imageSelections, *dir);
+    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(sprite, imageSelections, *dir);
     state->RegisterImageAnimator(imageAnimator);
     auto rect = state->RegisterCollider(Shape::ColliderType::Entity);
     std::initializer_list<ColliderSelection> colliderSelections{
@@ -230,8 +230,8 @@ void MoleEntity::DefineCollisionState(std::shared_ptr<State> state)
         }
     };
     auto animation = service_->CreateImageAnimation(collisionImages);
-    auto sprite = state->RegisterSprite();
-    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame>>(*sprite, animation);
+    auto& sprite = state->RegisterSprite();
+    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame>>(sprite, animation);
     imageAnimator->RegisterUpdateCb(updateCB);
     state->RegisterImageAnimator(imageAnimator);
 }
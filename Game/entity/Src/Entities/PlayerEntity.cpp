@@ -339,7 +339,7 @@ void PlayerEntity::OnInit()
 
 void PlayerEntity::DefineIdleState(std::shared_ptr<State> state)
 {
-    auto sprite = state->RegisterSprite();
+    auto& sprite = state->RegisterSprite();
     FaceDirection* dir = nullptr;
     propertyStore_.GetPtr("FaceDirection", dir);
     std::initializer_list<ImageSelection> imageSelections{
@@ -347,7 +347,7 @@ void PlayerEntity::DefineIdleState(std::shared_ptr<State> state)
         {FaceDirection::Right, service_->CreateImageAnimation(idleRightImages)},
         {FaceDirection::Front, service_->CreateImageAnimation(idleFrontImages)},
         {FaceDirection::Back, service_->CreateImageAnimation(idleBackImages)}};
-    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(*sprite, imageSelections, *dir);
+    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(sprite, imageSelections, *dir);
     state->RegisterImageAnimator(imageAnimator);
     auto rect = state->RegisterCollider(Shape::ColliderType::Entity);
     std::initializer_list<ColliderSelection> colliderSelections{
@@ -370,7 +370,7 @@ void PlayerEntity::DefineIdleState(std::shared_ptr<State> state)
 
 void PlayerEntity::DefineMoveState(std::shared_ptr<State> state)
 {
-    auto sprite = state->RegisterSprite();
+    auto& sprite = state->RegisterSprite();
     FaceDirection* dir = nullptr;
     propertyStore_.GetPtr("FaceDirection", dir);
     std::initializer_list<ImageSelection> imageSelections{
@@ -378,7 +378,7 @@ void PlayerEntity::DefineMoveState(std::shared_ptr<State> state)
         {FaceDirection::Right, service_->CreateImageAnimation(walkRightImages)},
         {FaceDirection::Front, service_->CreateImageAnimation(walkFrontImages)},
         {FaceDirection::Back, service_->CreateImageAnimation(walkBackImages)}};
-    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(*sprite, imageSelections, *dir);
+    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(sprite, imageSelections, *dir);
     state->RegisterImageAnimator(imageAnimator);
     auto rect = state->RegisterCollider(Shape::ColliderType::Entity);
     std::initializer_list<ColliderSelection> colliderSelections{
@@ -417,14 +417,14 @@ void PlayerEntity::DefineDoorMoveState(std::shared_ptr<State> state)
     auto updateCB = [this](Graphic::SpriteIf& drawable, const Shared::AnimationIf<Shared::ImageFrame>& animation) {
         drawable.setColor(sf::Color(255, 255, 255, 128));
     };
-    auto sprite = state->RegisterSprite();
+    auto& sprite = state->RegisterSprite();
     FaceDirection* dir = nullptr;
     propertyStore_.GetPtr("FaceDirection", dir);
     std::initializer_list<ImageSelection> imageSelections{
         {FaceDirection::Front, service_->CreateImageAnimation(walkFrontImages)},
         {FaceDirection::Back, service_->CreateImageAnimation(walkBackImages)}};
     auto imageAnimator =
-        std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(*sprite, imageSelections, *dir, true);
+        std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(sprite, imageSelections, *dir, true);
     imageAnimator->RegisterUpdateCb(updateCB);
     state->RegisterImageAnimator(imageAnimator);
 
@@ -456,7 +456,7 @@ void PlayerEntity::DefineAttackState(std::shared_ptr<State> state)
             ChangeStateTo(StateType::Idle, nullptr);
         }
     };
-    auto sprite = state->RegisterSprite();
+    auto& sprite = state->RegisterSprite();
     FaceDirection* dir = nullptr;
     propertyStore_.GetPtr("FaceDirection", dir);
     std::initializer_list<ImageSelection> imageSelections{
@@ -464,7 +464,7 @@ void PlayerEntity::DefineAttackState(std::shared_ptr<State> state)
         {FaceDirection::Right, service_->CreateImageAnimation(attackRightImages)},
         {FaceDirection::Front, service_->CreateImageAnimation(attackFrontImages)},
         {FaceDirection::Back, service_->CreateImageAnimation(attackBackImages)}};
-    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(*sprite, imageSelections, *dir);
+    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(sprite, imageSelections, *dir);
     imageAnimator->RegisterUpdateCb(updateCB);
     state->RegisterImageAnimator(imageAnimator);
     auto rect = state->RegisterCollider(Shape::ColliderType::Entity);
@@ -489,7 +489,7 @@ void PlayerEntity::DefineAttackWeaponState(std::shared_ptr<State> state)
             ChangeStateTo(StateType::Idle, nullptr);
         }
     };
-    auto sprite = state->RegisterSprite();
+    auto& sprite = state->RegisterSprite();
     FaceDirection* dir = nullptr;
     propertyStore_.GetPtr("FaceDirection", dir);
     std::initializer_list<ImageSelection> imageSelections{
@@ -497,7 +497,7 @@ void PlayerEntity::DefineAttackWeaponState(std::shared_ptr<State> state)
         {FaceDirection::Right, service_->CreateImageAnimation(attackWRightImages)},
         {FaceDirection::Front, service_->CreateImageAnimation(attackWFrontImages)},
         {FaceDirection::Back, service_->CreateImageAnimation(attackWBackImages)}};
-    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(*sprite, imageSelections, *dir);
+    auto imageAnimator = std::make_shared<Animator<Shared::ImageFrame, FaceDirection>>(sprite, imageSelections, *dir);
     imageAnimator->RegisterUpdateCb(updateCB);
     state->RegisterImageAnimator(imageAnimator);
     auto rect = state->RegisterCollider(Shape::ColliderType::Entity);
@@ -12,6 +12,7 @@
 #include "EntityIf.h"
 #include "EntityService.h"
 #include "Factory.h"
+#include "Profiler.h"
 
 namespace FA {
 
@@ -25,6 +26,7 @@ EntityHandler::~EntityHandler() = default;
 
 void EntityHandler::Update(float deltaTime)
 {
+    PROFILE_SCOPE("EntityHandler::Update");
     for (const auto id : allEntities_) {
         entityDb_.GetEntity(id).Update(deltaTime);
     }
@@ -23,6 +23,7 @@
 #include "Resource/SheetId.h"
 #include "Resource/SheetItem.h"
 #include "Resource/SheetManager.h"
+#include "Resource/SpriteSheetIf.h"
 #include "Resource/TextureManager.h"
 #include "Resource/TextureRect.h"
 #include "Sequence.h"
@@ -31,6 +32,12 @@ namespace FA {
 
 namespace Entity {
 
+namespace {
+
+const Util::InternedString unknownSheet = Shared::SheetId::Unknown;
+
+}  // namespace
+
 EntityService::EntityService(Shared::MessageBus& messageBus, const Shared::TextureManager& textureManager,
                              const Shared::SheetManager& sheetManager, const Shared::CameraViews& cameraViews,
                              const EntityDb& entityDb, EntityLifeHandler& entityLifeHandler,
@@ -64,11 +71,25 @@ std::shared_ptr<Shared::SequenceIf<Shared::ImageFrame>> EntityService::CreateSeq
     float t = Constant::stdSwitchTime;
     auto seq = std::make_shared<Shared::Sequence<Shared::ImageFrame>>(t);
 
+    // The frames of a sequence are mostly from one sheet and texture, they are only resolved when they change
+    const Shared::SpriteSheetIf* sheet = nullptr;
+    Util::InternedString sheetId;
+    const Graphic::TextureIf* texture = nullptr;
+    Shared::ResourceId textureId = Shared::InvalidResourceId;
+
     for (const auto& image : images) {
-        auto textureRect = sheetManager_.GetTextureRect(image.sheetItem_);
+        const auto& item = image.sheetItem_;
+        if (sheet == nullptr || item.id_ != sheetId) {
+            sheetId = item.id_;
+            sheet = sheetManager_.GetSheet(sheetId);
+        }
+        auto textureRect = sheet != nullptr ? sheet->At(item.position_) : Shared::TextureRect{};
         auto textureSize = sf::Vector2i(textureRect.rect_.width, textureRect.rect_.height);
         textureRect = image.mirror_ ? MirrorX(textureRect) : textureRect;
-        const auto* texture = textureManager_.Get(textureRect.id_);
+        if (texture == nullptr || textureRect.id_ != textureId) {
+            textureId = textureRect.id_;
+            texture = textureManager_.Get(textureId);
+        }
         sf::Vector2i center = textureSize / 2;
         seq->Add({texture, textureRect.rect_, static_cast<sf::Vector2f>(center)});
     }
@@ -87,7 +108,7 @@ std::shared_ptr<Shared::SequenceIf<Shared::ColliderFrame>> EntityService::Create
         sf::Vector2i colliderSize{};
         sf::Vector2i center{};
 
-        if (collider.sheetItem_.id_ == Shared::SheetId::Unknown) {
+        if (collider.sheetItem_.id_ == unknownSheet) {
             colliderSize = {collider.rect_.width, collider.rect_.height};
             center = colliderSize / 2;
         }
@@ -6,6 +6,8 @@
 
 #include "Shape.h"
 
+#include <algorithm>
+
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Rect.hpp>
 
@@ -13,7 +15,6 @@
 #include "Body.h"
 #include "RectangleShape.h"
 #include "RenderTargetIf.h"
-#include "Sprite.h"
 
 namespace FA {
 
@@ -35,8 +36,8 @@ void Shape::Enter()
         animator->Enter();
     }
     for (auto &sprite : sprites_) {
-        sprite->setPosition(body_.position_);
-        sprite->setRotation(body_.rotation_);
+        sprite.setPosition(body_.position_);
+        sprite.setRotation(body_.rotation_);
     }
 
     for (auto animator : colliderAnimators_) {
@@ -62,8 +63,8 @@ void Shape::Update(float deltaTime)
     }
 
     for (auto &sprite : sprites_) {
-        sprite->setPosition(body_.position_);
-        sprite->setRotation(body_.rotation_);
+        sprite.setPosition(body_.position_);
+        sprite.setRotation(body_.rotation_);
     }
     for (auto &element : colliders_) {
         element.rect_->setPosition(body_.position_);
@@ -75,12 +76,11 @@ void Shape::Update(float deltaTime)
 #endif  // _DEBUG
 }
 
-std::shared_ptr<Graphic::SpriteIf> Shape::RegisterSprite()
+Graphic::SpriteIf &Shape::RegisterSprite()
 {
-    auto sprite = std::make_shared<Graphic::Sprite>();
-    sprites_.push_back(sprite);
+    sprites_.emplace_back();
 
-    return sprite;
+    return sprites_.back();
 }
 
 std::shared_ptr<Graphic::RectangleShapeIf> Shape::RegisterCollider(ColliderType type)
@@ -112,7 +112,7 @@ void Shape::RegisterColliderAnimator(std::shared_ptr<AnimatorIf<Shared::Collider
 void Shape::DrawTo(Graphic::RenderTargetIf &renderTarget) const
 {
     for (auto &sprite : sprites_) {
-        renderTarget.draw(*sprite);
+        renderTarget.draw(sprite);
     }
 
 #ifdef _DEBUG
@@ -124,6 +124,34 @@ void Shape::DrawTo(Graphic::RenderTargetIf &renderTarget) const
 #endif
 }
 
+// Union of sprites and colliders, used to cull entities outside the view
+sf::FloatRect Shape::GetBounds() const
+{
+    sf::FloatRect bounds(body_.position_, {});
+    bool first = true;
+    auto add = [&bounds, &first](const sf::FloatRect &rect) {
+        if (first) {
+            bounds = rect;
+            first = false;
+            return;
+        }
+        float left = std::min(bounds.left, rect.left);
+        float top = std::min(bounds.top, rect.top);
+        float right = std::max(bounds.left + bounds.width, rect.left + rect.width);
+        float bottom = std::max(bounds.top + bounds.height, rect.top + rect.height);
+        bounds = {left, top, right - left, bottom - top};
+    };
+
+    for (const auto &sprite : sprites_) {
+        add(sprite.getGlobalBounds());
+    }
+    for (const auto &element : colliders_) {
+        add(element.rect_->getGlobalBounds());
+    }
+
+    return bounds;
+}
+
 bool Shape::Intersect(const Shape &otherShape) const
 {
     bool intersect = false;
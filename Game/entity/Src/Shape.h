@@ -6,9 +6,13 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <vector>
 
+#include "SfmlFwd.h"
+#include "Sprite.h"
+
 #ifdef _DEBUG
 #include "RectangleShape.h"
 #endif
@@ -18,7 +22,6 @@ namespace FA {
 namespace Graphic {
 
 class RenderTargetIf;
-class SpriteIf;
 class RectangleShapeIf;
 
 }  // namespace Graphic
@@ -44,7 +47,7 @@ public:
     Shape(Body &body);
     ~Shape();
 
-    std::shared_ptr<Graphic::SpriteIf> RegisterSprite();
+    Graphic::SpriteIf &RegisterSprite();
     std::shared_ptr<Graphic::RectangleShapeIf> RegisterCollider(ColliderType type);
     void RegisterImageAnimator(std::shared_ptr<AnimatorIf<Shared::ImageFrame>> animator);
     void RegisterColliderAnimator(std::shared_ptr<AnimatorIf<Shared::ColliderFrame>> animator);
@@ -52,6 +55,7 @@ public:
     void Update(float deltaTime);
     void DrawTo(Graphic::RenderTargetIf &renderTarget) const;
     bool Intersect(const Shape &shape) const;
+    sf::FloatRect GetBounds() const;
 
 private:
     struct ColliderElement
@@ -62,7 +66,7 @@ private:
 
     std::vector<std::shared_ptr<AnimatorIf<Shared::ImageFrame>>> imageAnimators_;
     std::vector<std::shared_ptr<AnimatorIf<Shared::ColliderFrame>>> colliderAnimators_;
-    std::vector<std::shared_ptr<Graphic::SpriteIf>> sprites_;
+    std::deque<Graphic::Sprite> sprites_;  // animators keep references, appending to a deque does not move elements
     std::vector<ColliderElement> colliders_;
     Body &body_;
 #ifdef _DEBUG
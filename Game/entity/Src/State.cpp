@@ -78,7 +78,7 @@ void State::RegisterAbility(std::shared_ptr<AbilityIf> ability)
     abilities_.emplace_back(ability);
 }
 
-std::shared_ptr<Graphic::SpriteIf> State::RegisterSprite()
+Graphic::SpriteIf& State::RegisterSprite()
 {
     return shape_.RegisterSprite();
 }
@@ -11,19 +11,44 @@
 #include <SFML/Window/WindowStyle.hpp>
 #include <SFML/Graphics/View.hpp>
 
+#include "Folder.h"
 #include "InputSystem.h"
 #include "Logging.h"
 #include "Manager.h"
+#include "Message/BroadcastMessage/KeyPressedMessage.h"
 #include "Message/MessageBus.h"
+#include "Message/MessageType.h"
+#include "Profiler.h"
+#include "RenderThread.h"
 #include "RenderWindow.h"
 #include "Resource/TextureManager.h"
 #include "Screen.h"
 #include "SfmlLog.h"
 #include "Title.h"
+#include "TraceWriter.h"
 #include "Version.h"
 
 namespace FA {
 
+namespace {
+
+constexpr std::size_t textureBudget = 256 * 1024 * 1024;  // bytes
+
+// Stops the render thread when the game loop is left, also by an exception, before the scenes it draws are destroyed
+class RenderThreadGuard
+{
+public:
+    RenderThreadGuard(RenderThread& renderThread)
+        : renderThread_(renderThread)
+    {}
+    ~RenderThreadGuard() { renderThread_.Stop(); }
+
+private:
+    RenderThread& renderThread_;
+};
+
+}  // namespace
+
 int Game::Run()
 {
     LOG_INFO_ENTER_FUNC();
@@ -60,23 +85,66 @@ void Game::GameLoop()
     Shared::MessageBus messageBus;
     auto createFn = []() { return std::make_unique<Graphic::Texture>(); };
     Shared::TextureManager textureManager(createFn);
-    Scene::Manager sceneManager(messageBus, textureManager);
+    // pages of levels that are switched away from are kept for a later visit, until the budget is reached
+    textureManager.SetBudget(textureBudget);
+    RenderThread renderThread(window);
+    // last frame might still be rendered with resources from the scene that is switched away from
+    Scene::Manager sceneManager(messageBus, textureManager, [&renderThread]() { renderThread.Wait(); });
+    RenderThreadGuard renderThreadGuard(renderThread);
     SfmlLog sfmlLog;
     sf::Clock clock;
     InputSystem inputSystem(messageBus, window);
 
     sfmlLog.Init();
+#if FA_PROFILER
+    PROFILE_THREAD_NAME("Main");
+    Util::TraceWriter traceWriter;
+    unsigned int nTraces = 0;
+    auto writeTrace = [&traceWriter, &nTraces]() {
+        auto filePath = Util::GetLogPath() + "/trace-" + std::to_string(++nTraces) + ".json";
+        LOG_INFO("Write trace to %s", DUMP(filePath));
+        traceWriter.Write(Util::Profiler::Instance().GetTrace(), filePath);
+    };
+    messageBus.AddSubscriber("game", Shared::MessageType::KeyPressed,
+                             [&writeTrace](std::shared_ptr<Shared::Message> msg) {
+                                 auto m = std::dynamic_pointer_cast<Shared::KeyPressedMessage>(msg);
+                                 if (m->GetKey() == sf::Keyboard::Key::F11) writeTrace();
+                             });
+#endif
+    renderThread.Start();
     LOG_INFO("Start main loop");
     while (sceneManager.IsRunning()) {
-        sf::Time elapsed = clock.restart();
-        float deltaTime = elapsed.asSeconds();
-        inputSystem.Update(deltaTime);
-        sceneManager.Update(deltaTime);
-        window.clear();
-        sceneManager.DrawTo(window);
-        window.display();
+        {
+            PROFILE_SCOPE("Frame");
+            sf::Time elapsed = clock.restart();
+            float deltaTime = elapsed.asSeconds();
+            {
+                PROFILE_SCOPE("Input");
+                inputSystem.Update(deltaTime);
+            }
+            {
+                PROFILE_SCOPE("Update");
+                sceneManager.Update(deltaTime);
+            }
+            {
+                PROFILE_SCOPE("Draw");
+                auto& drawList = renderThread.GetDrawList();
+                drawList.Clear();
+                sceneManager.DrawTo(drawList);
+            }
+            {
+                PROFILE_SCOPE("Display");
+                renderThread.Submit();
+            }
+        }
+        PROFILE_END_FRAME();
     }
 
+#if FA_PROFILER
+    messageBus.RemoveSubscriber("game", Shared::MessageType::KeyPressed);
+    writeTrace();
+#endif
+    renderThread.Stop();
     window.close();
 }
 
@@ -0,0 +1,96 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "RenderThread.h"
+
+#include "Logging.h"
+#include "Profiler.h"
+
+namespace FA {
+
+RenderThread::RenderThread(Graphic::RenderWindowIf& window)
+    : window_(window)
+{}
+
+RenderThread::~RenderThread()
+{
+    Stop();
+}
+
+void RenderThread::Start()
+{
+    if (thread_.joinable()) return;
+
+    LOG_INFO("Start render thread");
+    // OpenGL context can only be active in one thread at a time
+    window_.setActive(false);
+    isRunning_ = true;
+    thread_ = std::thread(&RenderThread::Run, this);
+}
+
+void RenderThread::Stop()
+{
+    if (!thread_.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isRunning_ = false;
+    }
+    condition_.notify_all();
+    thread_.join();
+    window_.setActive(true);
+    LOG_INFO("Render thread stopped");
+}
+
+void RenderThread::Submit()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this]() { return !isPending_; });
+        recordIndex_ = 1 - recordIndex_;
+        isPending_ = true;
+    }
+    condition_.notify_all();
+}
+
+void RenderThread::Wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this]() { return !isPending_; });
+}
+
+void RenderThread::Run()
+{
+    PROFILE_THREAD_NAME("Render");
+    window_.setActive(true);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        condition_.wait(lock, [this]() { return isPending_ || !isRunning_; });
+        if (!isPending_) break;
+
+        const auto& drawList = drawLists_[1 - recordIndex_];
+        lock.unlock();
+        {
+            PROFILE_SCOPE("Render");
+            window_.clear();
+            window_.draw(drawList);
+        }
+        {
+            PROFILE_SCOPE("Present");
+            window_.display();
+        }
+        PROFILE_END_FRAME();
+        lock.lock();
+
+        isPending_ = false;
+        condition_.notify_all();
+    }
+
+    window_.setActive(false);
+}
+
+}  // namespace FA
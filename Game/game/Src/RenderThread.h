@@ -0,0 +1,49 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "DrawList.h"
+#include "RenderWindowIf.h"
+
+namespace FA {
+
+/* Draws and displays frames on its own thread, so the next frame can be updated meanwhile.
+ * The game loop records into GetDrawList and hands it over with Submit. One list is rendered
+ * while the other is recorded, so Submit waits until the previous frame has been displayed.
+ */
+class RenderThread
+{
+public:
+    RenderThread(Graphic::RenderWindowIf& window);
+    ~RenderThread();
+
+    void Start();
+    void Stop();
+    Graphic::DrawList& GetDrawList() { return drawLists_[recordIndex_]; }
+    void Submit();
+    void Wait();  // until submitted frame is displayed, call before destroying anything it refers to
+
+private:
+    Graphic::RenderWindowIf& window_;
+    std::array<Graphic::DrawList, 2> drawLists_;
+    std::size_t recordIndex_ = 0;
+    bool isPending_ = false;
+    bool isRunning_ = false;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::thread thread_;
+
+private:
+    void Run();
+};
+
+}  // namespace FA
@@ -0,0 +1,44 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "RenderTargetIf.h"
+
+namespace FA {
+
+namespace Graphic {
+
+/* Collects consecutive sprites sharing a texture into one vertex array, which is drawn to the
+ * underlying target as a single draw call. Draw order is kept, so a batch is flushed when the
+ * texture changes or when something else than a sprite is drawn.
+ */
+class BatchRenderTarget : public RenderTargetIf
+{
+public:
+    BatchRenderTarget();
+    virtual ~BatchRenderTarget();
+
+    void Begin(RenderTargetIf &target);
+    void End();
+    void Flush();
+    virtual void draw(const DrawableIf &drawable) override;
+
+private:
+    friend class DrawList;
+    friend class RecordingRenderTarget;
+
+    class Batch;
+
+    std::unique_ptr<Batch> batch_;
+    RenderTargetIf *target_{nullptr};
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,56 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "DrawableIf.h"
+#include "RenderTargetIf.h"
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class RenderTexture;
+class View;
+
+/* Draw calls recorded on one thread and replayed on another, by drawing the list to a window.
+ * Drawables are copied when recorded, so they can change as soon as draw returns. Textures, fonts
+ * and indexed tile layers are only referenced and must stay alive until the list has been drawn.
+ * Texture passes and updates are kept until the list is cleared. Sprites, texts, rectangle shapes,
+ * vertex arrays, batches, tile layers, texture passes and texture updates can be recorded, anything
+ * else asserts.
+ */
+class DrawList : public RenderTargetIf, public DrawableIf
+{
+public:
+    DrawList();
+    virtual ~DrawList();
+
+    virtual void draw(const DrawableIf &drawable) override;
+
+    void SetView(const View &view);
+    void ResetView();  // default view of the current target
+    // Following calls go to renderTexture, which is cleared first and displayed on EndTexture
+    void BeginTexture(RenderTexture &renderTexture, const sf::Color &clearColor);
+    void EndTexture();
+    void Clear();
+    std::size_t GetNumberOfCommands() const;
+
+private:
+    class Commands;
+
+    std::unique_ptr<Commands> commands_;
+
+private:
+    virtual operator const sf::Drawable &() const override;
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -22,6 +22,10 @@ public:
 private:
     friend class RenderWindow;
     friend class RenderTexture;
+    friend class BatchRenderTarget;
+    friend class DrawList;
+    friend class RecordingRenderTarget;
+    friend class TexturePass;
 
 private:
     virtual operator const sf::Drawable&() const = 0;
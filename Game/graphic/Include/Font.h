@@ -7,6 +7,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "FontIf.h"
 #include "SfmlFwd.h"
@@ -22,10 +23,14 @@ public:
 
     virtual bool loadFromFile(const std::string &filename) override;
 
+    // Loading glyphs changes the pages of a font, held while glyphs are loaded and while pages are drawn
+    static std::mutex &GetGlyphMutex();
+
 private:
     std::shared_ptr<sf::Font> font_;
 
     friend class Text;
+    friend class TextBatch;
 
 private:
     operator const sf::Font &() const { return *font_; };
@@ -0,0 +1,46 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ImageIf.h"
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class TextureIf;
+
+// Pixels in system memory, used to compose textures before they are uploaded
+class Image : public ImageIf
+{
+public:
+    Image();
+
+    virtual void create(unsigned int width, unsigned int height) override;
+    virtual void create(unsigned int width, unsigned int height, const std::uint8_t *pixels) override;
+    virtual bool loadFromFile(const std::string &filename) override;
+    virtual sf::Vector2u getSize() const override;
+    virtual const std::uint8_t *getPixelsPtr() const override;
+    virtual void copy(const ImageIf &source, unsigned int destX, unsigned int destY) override;
+    void loadFromTexture(const TextureIf &texture);  // slow, reads back from video memory
+
+private:
+    std::shared_ptr<sf::Image> image_;
+
+    friend class Texture;
+    friend class TextureUpdate;
+
+private:
+    operator const sf::Image &() const { return *image_; }
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
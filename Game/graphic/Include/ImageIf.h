@@ -0,0 +1,32 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class ImageIf
+{
+public:
+    virtual ~ImageIf() = default;
+    virtual void create(unsigned int width, unsigned int height) = 0;
+    virtual void create(unsigned int width, unsigned int height, const std::uint8_t *pixels) = 0;  // RGBA
+    virtual bool loadFromFile(const std::string &filename) = 0;
+    virtual sf::Vector2u getSize() const = 0;
+    virtual const std::uint8_t *getPixelsPtr() const = 0;
+    virtual void copy(const ImageIf &source, unsigned int destX, unsigned int destY) = 0;
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
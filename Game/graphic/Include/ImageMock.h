@@ -0,0 +1,31 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <gmock/gmock.h>
+
+#include "ImageIf.h"
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class ImageMock : public ImageIf
+{
+public:
+    MOCK_METHOD((void), create, (unsigned int, unsigned int), (override));
+    MOCK_METHOD((void), create, (unsigned int, unsigned int, const std::uint8_t*), (override));
+    MOCK_METHOD((bool), loadFromFile, (const std::string&), (override));
+    MOCK_METHOD((sf::Vector2u), getSize, (), (const override));
+    MOCK_METHOD((const std::uint8_t*), getPixelsPtr, (), (const override));
+    MOCK_METHOD((void), copy, (const ImageIf&, unsigned int, unsigned int), (override));
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
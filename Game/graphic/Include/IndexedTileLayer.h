@@ -0,0 +1,55 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "DrawableIf.h"
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class TextureIf;
+
+/* A grid of equally sized tiles drawn as one quad. Every tile is a texel in an index texture, holding
+ * the position of the tile in the tileset, and a fragment shader looks up the tileset pixel. The
+ * tileset is only referenced and must outlive the layer.
+ */
+class IndexedTileLayer : public DrawableIf
+{
+public:
+    IndexedTileLayer();
+    virtual ~IndexedTileLayer();
+
+    static bool isAvailable();
+
+    bool create(const sf::Vector2u &gridSize, const sf::Vector2u &tileSize, const TextureIf &tileset);
+    void setTile(const sf::Vector2u &tile, const sf::Vector2u &tilesetPosition);  // position in pixels
+    void clearTile(const sf::Vector2u &tile);
+    void update();  // tiles changed since last update are uploaded when the layer is next drawn
+    const TextureIf *getTileset() const;
+    sf::Vector2u getTileSize() const;
+    sf::FloatRect getBounds() const;
+
+private:
+    friend class DrawList;
+    friend class RecordingRenderTarget;
+
+    class Layer;
+
+    std::unique_ptr<Layer> layer_;
+
+private:
+    virtual operator const sf::Drawable &() const override;
+    const sf::Texture *getTexture() const;
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
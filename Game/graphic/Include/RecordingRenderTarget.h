@@ -0,0 +1,52 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include "RenderTargetIf.h"
+
+namespace FA {
+
+namespace Graphic {
+
+/* Records draw calls into a command list instead of rendering them, so drawing can be measured
+ * without a window or a GPU. Textures are only kept as identities, they are never dereferenced.
+ */
+class RecordingRenderTarget : public RenderTargetIf
+{
+public:
+    enum class CommandType { Sprite, Batch, VertexArray, TileLayer, Text, Shape, TexturePass, Other };
+
+    struct Command
+    {
+        CommandType type_{};
+        const void *texture_{nullptr};
+        sf::IntRect textureRect_;  // sprite only
+        sf::Transform transform_;
+        std::size_t nVertices_{};  // batch and vertex array only
+    };
+
+public:
+    virtual void draw(const DrawableIf &drawable) override;
+
+    void Clear() { commands_.clear(); }
+    const std::vector<Command> &GetCommands() const { return commands_; }
+    std::size_t GetNumberOfDrawCalls() const { return commands_.size(); }
+    std::size_t GetNumberOfDrawCalls(CommandType type) const;
+    std::size_t GetNumberOfTextureSwitches() const;
+
+private:
+    std::vector<Command> commands_;
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
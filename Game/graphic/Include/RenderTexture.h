@@ -34,6 +34,9 @@ public:
 private:
     std::unique_ptr<sf::RenderTexture> renderTexture_;
     std::shared_ptr<const Graphic::TextureIf> texture_;
+
+    friend class DrawList;
+    friend class TexturePass;
 };
 
 }  // namespace Graphic
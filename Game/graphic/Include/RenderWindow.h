@@ -31,6 +31,7 @@ public:
     virtual void clear() override;
     virtual void clear(const sf::Color &color) override;
     virtual void setView(const sf::View &view) override;
+    virtual bool setActive(bool active = true) override;
 
 private:
     std::unique_ptr<sf::RenderWindow> renderWindow_;
@@ -28,6 +28,7 @@ public:
     virtual void clear() = 0;
     virtual void clear(const sf::Color &color) = 0;
     virtual void setView(const sf::View &view) = 0;
+    virtual bool setActive(bool active = true) = 0;
 };
 
 }  // namespace Graphic
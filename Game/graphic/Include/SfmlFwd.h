@@ -21,6 +21,7 @@ typedef Vector2<float> Vector2f;
 
 class RectangleShape;
 class Texture;
+class Image;
 class RenderWindow;
 class RenderTarget;
 class RenderTexture;
@@ -31,7 +32,9 @@ class Font;
 class Drawable;
 class Color;
 class VideoMode;
-class Text;	
+class Text;
+class Vertex;
+class VertexArray;
 
 typedef unsigned int Uint32;
 
@@ -6,7 +6,7 @@
 
 #pragma once
 
-#include <memory>
+#include <SFML/Graphics/Sprite.hpp>
 
 #include "SfmlFwd.h"
 #include "SpriteIf.h"
@@ -15,12 +15,18 @@ namespace FA {
 
 namespace Graphic {
 
-class Sprite : public SpriteIf
+class Texture;
+
+/* Value type, the sf::Sprite is stored inline so sprites can be copied and kept in containers without
+ * extra allocations. The class is final, so calls through Sprite rather than SpriteIf are not virtual.
+ */
+class Sprite final : public SpriteIf
 {
 public:
-    Sprite();
+    Sprite() = default;
 
     virtual void setTexture(const TextureIf &texture, bool resetRect = false) override;
+    void setTexture(const Texture &texture, bool resetRect = false);
     virtual void setTextureRect(const sf::IntRect &rectangle) override;
     virtual void setColor(const sf::Color &color) override;
     virtual const TextureIf *getTexture() const override;
@@ -34,7 +40,7 @@ public:
     virtual void setOrigin(float x, float y) override;
 
 private:
-    std::shared_ptr<sf::Sprite> sprite_;
+    sf::Sprite sprite_;
     const TextureIf *texture_{nullptr};
 
 private:
@@ -0,0 +1,67 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "SfmlFwd.h"
+#include "VertexArray.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class FontIf;
+class RenderTargetIf;
+class TextureIf;
+
+/* Single line texts sharing font and character size, drawn as one vertex array. Glyph geometry is
+ * only rebuilt when a string changes, and strings are kept in fixed buffers so updating them every
+ * frame does not allocate.
+ */
+class TextBatch
+{
+public:
+    using TextId = std::size_t;
+    static constexpr std::size_t maxLength = 64;  // including null terminator
+
+public:
+    void Create(const FontIf &font, unsigned int characterSize);
+    TextId Add(const sf::Vector2f &position, const sf::Color &color);
+    void SetString(TextId id, const std::string &string);
+    void Format(TextId id, const char *format, ...);
+    void DrawTo(RenderTargetIf &renderTarget);
+
+private:
+    struct Entry
+    {
+        sf::Vector2f position_;
+        sf::Color color_;
+        std::array<char, maxLength> string_{};
+    };
+
+    const sf::Font *font_{nullptr};
+    unsigned int characterSize_{};
+    std::vector<Entry> entries_;
+    VertexArray vertices_;
+    std::shared_ptr<const TextureIf> texture_;
+    bool dirty_{true};
+
+private:
+    void Set(TextId id, const char *string);
+    void Build();
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
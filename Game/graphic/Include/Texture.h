@@ -30,6 +30,8 @@ public:
     virtual bool loadFromFile(const std::string &filename, const sf::IntRect &area) override;
     virtual bool loadFromMemory(const void *data, std::size_t size) override;
     virtual bool loadFromMemory(const void *data, std::size_t size, const sf::IntRect &area) override;
+    virtual bool loadFromImage(const ImageIf &image) override;
+    virtual void update(const ImageIf &image, unsigned int x, unsigned int y) override;
 
     virtual sf::Vector2u getSize() const override;
 
@@ -38,6 +40,10 @@ private:
     sf::Texture *texture_{nullptr};
 
     friend class Sprite;
+    friend class VertexArray;
+    friend class IndexedTileLayer;
+    friend class Image;
+    friend class TextureUpdate;
 
 private:
     /* Since this constructor cast away the const from sf::Texture,
@@ -13,6 +13,8 @@ namespace FA {
 
 namespace Graphic {
 
+class ImageIf;
+
 class TextureIf
 {
 public:
@@ -22,6 +24,8 @@ public:
     virtual bool loadFromFile(const std::string &filename, const sf::IntRect &area) = 0;
     virtual bool loadFromMemory(const void *data, std::size_t size) = 0;
     virtual bool loadFromMemory(const void *data, std::size_t size, const sf::IntRect &area) = 0;
+    virtual bool loadFromImage(const ImageIf &image) = 0;
+    virtual void update(const ImageIf &image, unsigned int x, unsigned int y) = 0;
 
     virtual sf::Vector2u getSize() const = 0;
 };
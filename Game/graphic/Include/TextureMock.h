@@ -26,6 +26,9 @@ public:
     MOCK_METHOD((bool), loadFromMemory, (const void*, std::size_t), (override));
     MOCK_METHOD((bool), loadFromMemory, (const void*, std::size_t, const sf::IntRect&), (override));
 
+    MOCK_METHOD((bool), loadFromImage, (const ImageIf&), (override));
+    MOCK_METHOD((void), update, (const ImageIf&, unsigned int, unsigned int), (override));
+
     MOCK_METHOD((sf::Vector2u), getSize, (), (const override));
 };
 
@@ -0,0 +1,50 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "DrawableIf.h"
+#include "RenderTargetIf.h"
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class RenderTexture;
+class View;
+
+/* Draws into a render texture when the pass itself is drawn. Drawn to a draw list, the texture is
+ * written by the thread replaying the list, in order with the draws that use it, and not while an
+ * earlier list may still sample it. Sprites and rectangle shapes are copied when drawn to the pass,
+ * the render texture is only referenced and must stay alive until the pass has been drawn.
+ */
+class TexturePass : public DrawableIf, public RenderTargetIf
+{
+public:
+    TexturePass(RenderTexture &renderTexture, const View &view);
+    virtual ~TexturePass();
+
+    void clear(const sf::Color &color);
+    virtual void draw(const DrawableIf &drawable) override;
+
+private:
+    friend class DrawList;
+
+    class Pass;
+
+    std::shared_ptr<Pass> pass_;  // shared with the draw lists it is drawn to, so it is not copied
+
+private:
+    virtual operator const sf::Drawable &() const override;
+    std::shared_ptr<const sf::Drawable> GetDrawable() const;
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,47 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <SFML/System/Vector2.hpp>
+
+#include "DrawableIf.h"
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class ImageIf;
+class TextureIf;
+
+/* Writes an image into a texture when the update itself is drawn. Drawn to a draw list, the texture
+ * is written by the thread replaying the list, in order with the draws that sample it. The image is
+ * copied, the texture is only referenced and must stay alive until the update has been drawn.
+ */
+class TextureUpdate : public DrawableIf
+{
+public:
+    TextureUpdate(TextureIf &texture, const ImageIf &image, const sf::Vector2u &position);
+    virtual ~TextureUpdate();
+
+private:
+    friend class DrawList;
+
+    class Update;
+
+    std::shared_ptr<Update> update_;  // shared with the draw lists it is drawn to, so the image is not copied
+
+private:
+    virtual operator const sf::Drawable &() const override;
+    std::shared_ptr<const sf::Drawable> GetDrawable() const;
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,51 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "SfmlFwd.h"
+#include "VertexArrayIf.h"
+
+namespace FA {
+
+namespace Graphic {
+
+// Triangle list, every quad is 6 vertices. Texture coordinates are in pixels.
+class VertexArray : public VertexArrayIf
+{
+public:
+    VertexArray();
+
+    virtual void clear() override;
+    virtual void resize(std::size_t vertexCount) override;
+    virtual std::size_t getVertexCount() const override;
+    virtual void append(const sf::Vertex &vertex) override;
+    virtual sf::Vertex &operator[](std::size_t index) override;
+    virtual sf::FloatRect getBounds() const override;
+    virtual void setTexture(const TextureIf &texture) override;
+    // The texture is a glyph page, which fonts write to when they load glyphs
+    void setGlyphPage(bool isGlyphPage);
+
+private:
+    friend class DrawList;
+    friend class RecordingRenderTarget;
+
+    class TexturedVertexArray;
+
+    std::shared_ptr<TexturedVertexArray> vertexArray_;
+
+private:
+    virtual operator const sf::Drawable &() const override;
+    const sf::Texture *getTexture() const;
+    const sf::VertexArray &getVertices() const;
+    bool isGlyphPage() const;
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
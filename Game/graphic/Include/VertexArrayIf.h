@@ -0,0 +1,34 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "DrawableIf.h"
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class TextureIf;
+
+class VertexArrayIf : public DrawableIf
+{
+public:
+    virtual void clear() = 0;
+    virtual void resize(std::size_t vertexCount) = 0;
+    virtual std::size_t getVertexCount() const = 0;
+    virtual void append(const sf::Vertex &vertex) = 0;
+    virtual sf::Vertex &operator[](std::size_t index) = 0;
+    virtual sf::FloatRect getBounds() const = 0;
+    virtual void setTexture(const TextureIf &texture) = 0;
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -23,11 +23,14 @@ public:
     virtual void setSize(const sf::Vector2f &size) override;
     virtual void zoom(float factor) override;
     virtual void setCenter(const sf::Vector2f &center) override;
+    virtual void setViewport(const sf::FloatRect &viewport) override;
 
 private:
     std::shared_ptr<sf::View> view_;
 
+    friend class DrawList;
     friend class RenderTexture;
+    friend class TexturePass;
 
 private:
     operator const sf::View &() const { return *view_; };
@@ -20,6 +20,7 @@ public:
     virtual void setSize(const sf::Vector2f &size) = 0;
     virtual void zoom(float factor) = 0;
     virtual void setCenter(const sf::Vector2f &center) = 0;
+    virtual void setViewport(const sf::FloatRect &viewport) = 0;  // ratio of the target, drawing is clipped to it
 };
 
 }  // namespace Graphic
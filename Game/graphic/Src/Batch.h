@@ -0,0 +1,82 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cmath>
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include "BatchRenderTarget.h"
+#include "DrawableIf.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class BatchRenderTarget::Batch : public DrawableIf, public sf::Drawable
+{
+public:
+    Batch()
+        : vertices_(sf::Triangles)
+    {}
+
+    bool IsEmpty() const { return vertices_.getVertexCount() == 0; }
+    const sf::Texture *GetTexture() const { return texture_; }
+    std::size_t GetVertexCount() const { return vertices_.getVertexCount(); }
+    const sf::VertexArray &GetVertices() const { return vertices_; }
+
+    void Clear()
+    {
+        vertices_.clear();
+        texture_ = nullptr;
+    }
+
+    void Append(const sf::Sprite &sprite)
+    {
+        texture_ = sprite.getTexture();
+        const auto &rect = sprite.getTextureRect();
+        const auto &transform = sprite.getTransform();
+        const auto &color = sprite.getColor();
+        float width = static_cast<float>(std::abs(rect.width));
+        float height = static_cast<float>(std::abs(rect.height));
+        float left = static_cast<float>(rect.left);
+        float right = left + rect.width;
+        float top = static_cast<float>(rect.top);
+        float bottom = top + rect.height;
+
+        sf::Vertex topLeft(transform.transformPoint(0.0f, 0.0f), color, {left, top});
+        sf::Vertex topRight(transform.transformPoint(width, 0.0f), color, {right, top});
+        sf::Vertex bottomLeft(transform.transformPoint(0.0f, height), color, {left, bottom});
+        sf::Vertex bottomRight(transform.transformPoint(width, height), color, {right, bottom});
+
+        vertices_.append(topLeft);
+        vertices_.append(topRight);
+        vertices_.append(bottomRight);
+        vertices_.append(topLeft);
+        vertices_.append(bottomRight);
+        vertices_.append(bottomLeft);
+    }
+
+private:
+    sf::VertexArray vertices_;
+    const sf::Texture *texture_{nullptr};
+
+private:
+    virtual operator const sf::Drawable &() const override { return *this; }
+
+    virtual void draw(sf::RenderTarget &target, sf::RenderStates states) const override
+    {
+        states.texture = texture_;
+        target.draw(vertices_, states);
+    }
+};
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,63 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "BatchRenderTarget.h"
+
+#include <SFML/Graphics/Sprite.hpp>
+
+#include "Batch.h"
+#include "DrawableIf.h"
+
+namespace FA {
+
+namespace Graphic {
+
+BatchRenderTarget::BatchRenderTarget()
+    : batch_(std::make_unique<Batch>())
+{}
+
+BatchRenderTarget::~BatchRenderTarget() = default;
+
+void BatchRenderTarget::Begin(RenderTargetIf &target)
+{
+    target_ = &target;
+    batch_->Clear();
+}
+
+void BatchRenderTarget::End()
+{
+    Flush();
+    target_ = nullptr;
+}
+
+void BatchRenderTarget::Flush()
+{
+    if (target_ == nullptr || batch_->IsEmpty()) return;
+
+    target_->draw(*batch_);
+    batch_->Clear();
+}
+
+void BatchRenderTarget::draw(const DrawableIf &drawable)
+{
+    if (target_ == nullptr) return;
+
+    const sf::Drawable &sfDrawable = drawable;
+    auto sprite = dynamic_cast<const sf::Sprite *>(&sfDrawable);
+
+    if (sprite == nullptr) {
+        Flush();
+        target_->draw(drawable);
+    }
+    else if (sprite->getTexture() != nullptr) {
+        if (sprite->getTexture() != batch_->GetTexture()) Flush();
+        batch_->Append(*sprite);
+    }
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
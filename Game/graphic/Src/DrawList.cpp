@@ -0,0 +1,272 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "DrawList.h"
+
+#include <cassert>
+#include <mutex>
+#include <vector>
+
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include "Batch.h"
+#include "Font.h"
+#include "IndexedTileLayer.h"
+#include "RenderTexture.h"
+#include "TexturePass.h"
+#include "TextureUpdate.h"
+#include "VertexArray.h"
+#include "View.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class DrawList::Commands : public sf::Drawable
+{
+public:
+    enum class Type { Sprite, Text, Shape, Vertices, Referenced, Shared, View, DefaultView, BeginTexture, EndTexture };
+
+    void Clear()
+    {
+        commands_.clear();
+        sprites_.clear();
+        texts_.clear();
+        shapes_.clear();
+        vertices_.clear();
+        ranges_.clear();
+        referenced_.clear();
+        shared_.clear();
+        views_.clear();
+        passes_.clear();
+    }
+
+    std::size_t Size() const { return commands_.size(); }
+
+    void Add(const sf::Sprite &sprite) { Add(Type::Sprite, sprites_, sprite); }
+    void Add(const sf::RectangleShape &shape) { Add(Type::Shape, shapes_, shape); }
+    void Add(const sf::View &view) { Add(Type::View, views_, view); }
+    void AddReferenced(const sf::Drawable &drawable) { Add(Type::Referenced, referenced_, &drawable); }
+    void AddShared(std::shared_ptr<const sf::Drawable> drawable) { Add(Type::Shared, shared_, drawable); }
+    void AddDefaultView() { commands_.push_back({Type::DefaultView, 0}); }
+    void AddEndTexture() { commands_.push_back({Type::EndTexture, 0}); }
+
+    // Glyphs are looked up while recording, so the font is not modified from the render thread
+    void Add(const sf::Text &text)
+    {
+        Add(Type::Text, texts_, text);
+        std::lock_guard<std::mutex> lock(Font::GetGlyphMutex());
+        texts_.back().getLocalBounds();
+    }
+
+    void Add(const sf::VertexArray &vertices, const sf::Texture *texture, bool isGlyphPage)
+    {
+        auto first = vertices_.size();
+        for (std::size_t i = 0; i < vertices.getVertexCount(); i++) {
+            vertices_.push_back(vertices[i]);
+        }
+        Range range{texture, vertices.getPrimitiveType(), first, vertices.getVertexCount(), isGlyphPage};
+        Add(Type::Vertices, ranges_, range);
+    }
+
+    void AddBeginTexture(sf::RenderTexture &renderTexture, const sf::Color &clearColor)
+    {
+        Add(Type::BeginTexture, passes_, Pass{&renderTexture, clearColor});
+    }
+
+private:
+    struct Command
+    {
+        Type type_;
+        std::size_t index_;
+    };
+
+    struct Range
+    {
+        const sf::Texture *texture_;
+        sf::PrimitiveType primitiveType_;
+        std::size_t first_;
+        std::size_t count_;
+        bool isGlyphPage_;
+    };
+
+    struct Pass
+    {
+        sf::RenderTexture *renderTexture_;
+        sf::Color clearColor_;
+    };
+
+    std::vector<Command> commands_;
+    std::vector<sf::Sprite> sprites_;
+    std::vector<sf::Text> texts_;
+    std::vector<sf::RectangleShape> shapes_;
+    std::vector<sf::Vertex> vertices_;  // all vertex arrays in one buffer
+    std::vector<Range> ranges_;
+    std::vector<const sf::Drawable *> referenced_;
+    std::vector<std::shared_ptr<const sf::Drawable>> shared_;  // kept alive until the list is cleared
+    std::vector<sf::View> views_;
+    std::vector<Pass> passes_;
+
+private:
+    template <class T>
+    void Add(Type type, std::vector<T> &items, const T &item)
+    {
+        commands_.push_back({type, items.size()});
+        items.push_back(item);
+    }
+
+    virtual void draw(sf::RenderTarget &target, sf::RenderStates states) const override
+    {
+        const sf::View windowView = target.getView();
+        sf::RenderTarget *current = &target;
+        sf::RenderTexture *renderTexture = nullptr;
+
+        for (const auto &command : commands_) {
+            switch (command.type_) {
+                case Type::Sprite:
+                    current->draw(sprites_[command.index_], states);
+                    break;
+                case Type::Text: {
+                    std::lock_guard<std::mutex> lock(Font::GetGlyphMutex());
+                    current->draw(texts_[command.index_], states);
+                    break;
+                }
+                case Type::Shape:
+                    current->draw(shapes_[command.index_], states);
+                    break;
+                case Type::Vertices: {
+                    const auto &range = ranges_[command.index_];
+                    // a glyph page, e.g. of a text batch, is written when glyphs are loaded on the main thread
+                    std::unique_lock<std::mutex> lock(Font::GetGlyphMutex(), std::defer_lock);
+                    if (range.isGlyphPage_) lock.lock();
+                    sf::RenderStates vertexStates(states);
+                    vertexStates.texture = range.texture_;
+                    current->draw(&vertices_[range.first_], range.count_, range.primitiveType_, vertexStates);
+                    break;
+                }
+                case Type::Referenced:
+                    current->draw(*referenced_[command.index_], states);
+                    break;
+                case Type::Shared:
+                    current->draw(*shared_[command.index_], states);
+                    break;
+                case Type::View:
+                    current->setView(views_[command.index_]);
+                    break;
+                case Type::DefaultView:
+                    current->setView(current->getDefaultView());
+                    break;
+                case Type::BeginTexture: {
+                    const auto &pass = passes_[command.index_];
+                    renderTexture = pass.renderTexture_;
+                    renderTexture->setView(renderTexture->getDefaultView());
+                    renderTexture->clear(pass.clearColor_);
+                    current = renderTexture;
+                    break;
+                }
+                case Type::EndTexture:
+                    if (renderTexture != nullptr) renderTexture->display();
+                    renderTexture = nullptr;
+                    current = &target;
+                    break;
+            }
+        }
+
+        target.setView(windowView);
+    }
+};
+
+DrawList::DrawList()
+    : commands_(std::make_unique<Commands>())
+{}
+
+DrawList::~DrawList() = default;
+
+void DrawList::draw(const DrawableIf &drawable)
+{
+    if (auto vertexArray = dynamic_cast<const VertexArray *>(&drawable)) {
+        commands_->Add(vertexArray->getVertices(), vertexArray->getTexture(), vertexArray->isGlyphPage());
+        return;
+    }
+
+    // Texture passes and updates write their texture here, in order with the draws that use it
+    if (auto texturePass = dynamic_cast<const TexturePass *>(&drawable)) {
+        commands_->AddShared(texturePass->GetDrawable());
+        return;
+    }
+
+    if (auto textureUpdate = dynamic_cast<const TextureUpdate *>(&drawable)) {
+        commands_->AddShared(textureUpdate->GetDrawable());
+        return;
+    }
+
+    const sf::Drawable &sfDrawable = drawable;
+    // Tile layers are drawn by reference, tile changes are texel updates made from the recording thread
+    if (dynamic_cast<const IndexedTileLayer *>(&drawable) != nullptr) {
+        commands_->AddReferenced(sfDrawable);
+        return;
+    }
+
+    if (auto sprite = dynamic_cast<const sf::Sprite *>(&sfDrawable)) {
+        commands_->Add(*sprite);
+    }
+    else if (auto batch = dynamic_cast<const BatchRenderTarget::Batch *>(&sfDrawable)) {
+        commands_->Add(batch->GetVertices(), batch->GetTexture(), false);
+    }
+    else if (auto text = dynamic_cast<const sf::Text *>(&sfDrawable)) {
+        commands_->Add(*text);
+    }
+    else if (auto shape = dynamic_cast<const sf::RectangleShape *>(&sfDrawable)) {
+        commands_->Add(*shape);
+    }
+    else {
+        assert(false && "Drawable can not be recorded to a draw list");
+    }
+}
+
+void DrawList::SetView(const View &view)
+{
+    const sf::View &sfView = view;
+    commands_->Add(sfView);
+}
+
+void DrawList::ResetView()
+{
+    commands_->AddDefaultView();
+}
+
+void DrawList::BeginTexture(RenderTexture &renderTexture, const sf::Color &clearColor)
+{
+    commands_->AddBeginTexture(*renderTexture.renderTexture_, clearColor);
+}
+
+void DrawList::EndTexture()
+{
+    commands_->AddEndTexture();
+}
+
+void DrawList::Clear()
+{
+    commands_->Clear();
+}
+
+std::size_t DrawList::GetNumberOfCommands() const
+{
+    return commands_->Size();
+}
+
+DrawList::operator const sf::Drawable &() const
+{
+    return *commands_;
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
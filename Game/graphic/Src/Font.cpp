@@ -21,6 +21,12 @@ bool Font::loadFromFile(const std::string &string)
     return font_->loadFromFile(string);
 }
 
+std::mutex &Font::GetGlyphMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
 }  // namespace Graphic
 
 }  // namespace FA
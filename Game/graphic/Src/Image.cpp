@@ -0,0 +1,61 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "Image.h"
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include "Texture.h"
+
+namespace FA {
+
+namespace Graphic {
+
+Image::Image()
+    : image_(std::make_shared<sf::Image>())
+{}
+
+void Image::create(unsigned int width, unsigned int height)
+{
+    image_->create(width, height, sf::Color::Transparent);
+}
+
+void Image::create(unsigned int width, unsigned int height, const std::uint8_t *pixels)
+{
+    image_->create(width, height, pixels);
+}
+
+bool Image::loadFromFile(const std::string &filename)
+{
+    return image_->loadFromFile(filename);
+}
+
+sf::Vector2u Image::getSize() const
+{
+    return image_->getSize();
+}
+
+const std::uint8_t *Image::getPixelsPtr() const
+{
+    return image_->getPixelsPtr();
+}
+
+void Image::copy(const ImageIf &source, unsigned int destX, unsigned int destY)
+{
+    const sf::Image &sfImage = dynamic_cast<const Image &>(source);
+    image_->copy(sfImage, destX, destY);
+}
+
+void Image::loadFromTexture(const TextureIf &texture)
+{
+    const sf::Texture &sfTexture = dynamic_cast<const Texture &>(texture);
+    *image_ = sfTexture.copyToImage();
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,225 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "IndexedTileLayer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include "Texture.h"
+
+namespace FA {
+
+namespace Graphic {
+
+namespace {
+
+// A texel holds x in red and green, y in blue and the low bits of alpha. The high alpha bit marks a tile.
+constexpr unsigned int maxTilesetWidth = 1 << 16;
+constexpr unsigned int maxTilesetHeight = 1 << 15;
+constexpr std::uint8_t tileBit = 0x80;
+
+const char *fragmentShader =
+    "uniform sampler2D indices;\n"
+    "uniform sampler2D tileset;\n"
+    "uniform vec2 gridSize;\n"
+    "uniform vec2 tileSize;\n"
+    "uniform vec2 tilesetSize;\n"
+    "\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 position = gl_TexCoord[0].xy * gridSize;\n"
+    "    vec2 tile = floor(position);\n"
+    "    vec4 texel = floor(texture2D(indices, (tile + 0.5) / gridSize) * 255.0 + 0.5);\n"
+    "    if (texel.a < 128.0) discard;\n"
+    "    vec2 origin = vec2(texel.r + texel.g * 256.0, texel.b + (texel.a - 128.0) * 256.0);\n"
+    "    vec2 pixel = origin + floor((position - tile) * tileSize);\n"
+    "    gl_FragColor = gl_Color * texture2D(tileset, (pixel + 0.5) / tilesetSize);\n"
+    "}\n";
+
+}  // namespace
+
+class IndexedTileLayer::Layer : public sf::Drawable
+{
+public:
+    sf::Vector2u gridSize_;
+    sf::Vector2u tileSize_;
+    const sf::Texture *tileset_{nullptr};
+    const TextureIf *tilesetIf_{nullptr};
+    std::vector<std::uint8_t> texels_;  // RGBA, one per tile
+    mutable sf::Texture indices_;  // written when drawn, on the drawing thread
+    sf::Shader shader_;
+    sf::VertexArray quad_{sf::TriangleStrip, 4};
+    sf::Vector2u dirtyMin_;
+    sf::Vector2u dirtyMax_;
+    bool isDirty_{false};
+
+    // Changed tiles are copied by update and uploaded when the layer is drawn, the index texture is
+    // only touched by the thread that draws it
+    struct Upload
+    {
+        sf::Rect<unsigned int> rect_;
+        std::vector<std::uint8_t> texels_;
+    };
+    mutable std::mutex uploadMutex_;
+    mutable std::vector<Upload> uploads_;
+
+    void AddUpload()
+    {
+        Upload upload;
+        upload.rect_ = {dirtyMin_.x, dirtyMin_.y, dirtyMax_.x - dirtyMin_.x + 1, dirtyMax_.y - dirtyMin_.y + 1};
+        for (auto y = dirtyMin_.y; y <= dirtyMax_.y; y++) {
+            auto row = texels_.begin() + 4 * (y * gridSize_.x + dirtyMin_.x);
+            upload.texels_.insert(upload.texels_.end(), row, row + 4 * upload.rect_.width);
+        }
+
+        std::lock_guard<std::mutex> lock(uploadMutex_);
+        uploads_.push_back(std::move(upload));
+    }
+
+    void SetTexel(const sf::Vector2u &tile, std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
+    {
+        if (tile.x >= gridSize_.x || tile.y >= gridSize_.y) return;
+
+        auto *texel = &texels_[4 * (tile.y * gridSize_.x + tile.x)];
+        texel[0] = r;
+        texel[1] = g;
+        texel[2] = b;
+        texel[3] = a;
+
+        if (!isDirty_) {
+            dirtyMin_ = dirtyMax_ = tile;
+            isDirty_ = true;
+        }
+        else {
+            dirtyMin_ = {std::min(dirtyMin_.x, tile.x), std::min(dirtyMin_.y, tile.y)};
+            dirtyMax_ = {std::max(dirtyMax_.x, tile.x), std::max(dirtyMax_.y, tile.y)};
+        }
+    }
+
+private:
+    virtual void draw(sf::RenderTarget &target, sf::RenderStates states) const override
+    {
+        if (tileset_ == nullptr) return;
+
+        std::vector<Upload> uploads;
+        {
+            std::lock_guard<std::mutex> lock(uploadMutex_);
+            uploads.swap(uploads_);
+        }
+        for (const auto &upload : uploads) {
+            const auto &rect = upload.rect_;
+            indices_.update(upload.texels_.data(), rect.width, rect.height, rect.left, rect.top);
+        }
+
+        states.texture = &indices_;
+        states.shader = &shader_;
+        target.draw(quad_, states);
+    }
+};
+
+IndexedTileLayer::IndexedTileLayer()
+    : layer_(std::make_unique<Layer>())
+{}
+
+IndexedTileLayer::~IndexedTileLayer() = default;
+
+bool IndexedTileLayer::isAvailable()
+{
+    return sf::Shader::isAvailable();
+}
+
+bool IndexedTileLayer::create(const sf::Vector2u &gridSize, const sf::Vector2u &tileSize, const TextureIf &tileset)
+{
+    const sf::Texture &sfTileset = dynamic_cast<const Texture &>(tileset);
+    auto tilesetSize = sfTileset.getSize();
+    if (tilesetSize.x > maxTilesetWidth || tilesetSize.y > maxTilesetHeight) return false;
+    if (!layer_->indices_.create(gridSize.x, gridSize.y)) return false;
+    if (!layer_->shader_.loadFromMemory(fragmentShader, sf::Shader::Fragment)) return false;
+
+    layer_->shader_.setUniform("indices", sf::Shader::CurrentTexture);
+    layer_->shader_.setUniform("tileset", sfTileset);
+    layer_->shader_.setUniform("gridSize", sf::Glsl::Vec2(gridSize));
+    layer_->shader_.setUniform("tileSize", sf::Glsl::Vec2(tileSize));
+    layer_->shader_.setUniform("tilesetSize", sf::Glsl::Vec2(tilesetSize));
+
+    // positions in pixels, texture coordinates in tiles, i.e. index texture pixels
+    sf::Vector2f size(static_cast<float>(gridSize.x * tileSize.x), static_cast<float>(gridSize.y * tileSize.y));
+    sf::Vector2f grid(gridSize);
+    auto &quad = layer_->quad_;
+    quad[0] = sf::Vertex({0.0f, 0.0f}, {0.0f, 0.0f});
+    quad[1] = sf::Vertex({size.x, 0.0f}, {grid.x, 0.0f});
+    quad[2] = sf::Vertex({0.0f, size.y}, {0.0f, grid.y});
+    quad[3] = sf::Vertex(size, grid);
+
+    layer_->gridSize_ = gridSize;
+    layer_->tileSize_ = tileSize;
+    layer_->tileset_ = &sfTileset;
+    layer_->tilesetIf_ = &tileset;
+    layer_->texels_.assign(4 * gridSize.x * gridSize.y, 0);
+    layer_->indices_.update(layer_->texels_.data());
+    layer_->isDirty_ = false;
+    layer_->uploads_.clear();
+
+    return true;
+}
+
+void IndexedTileLayer::setTile(const sf::Vector2u &tile, const sf::Vector2u &tilesetPosition)
+{
+    auto x = tilesetPosition.x;
+    auto y = tilesetPosition.y;
+    layer_->SetTexel(tile, x & 0xff, (x >> 8) & 0xff, y & 0xff, tileBit | ((y >> 8) & 0x7f));
+}
+
+void IndexedTileLayer::clearTile(const sf::Vector2u &tile)
+{
+    layer_->SetTexel(tile, 0, 0, 0, 0);
+}
+
+void IndexedTileLayer::update()
+{
+    if (!layer_->isDirty_) return;
+
+    layer_->AddUpload();
+    layer_->isDirty_ = false;
+}
+
+const TextureIf *IndexedTileLayer::getTileset() const
+{
+    return layer_->tilesetIf_;
+}
+
+sf::Vector2u IndexedTileLayer::getTileSize() const
+{
+    return layer_->tileSize_;
+}
+
+sf::FloatRect IndexedTileLayer::getBounds() const
+{
+    return layer_->quad_.getBounds();
+}
+
+IndexedTileLayer::operator const sf::Drawable &() const
+{
+    return *layer_;
+}
+
+const sf::Texture *IndexedTileLayer::getTexture() const
+{
+    return layer_->tileset_;
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,92 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "RecordingRenderTarget.h"
+
+#include <algorithm>
+
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include "Batch.h"
+#include "DrawableIf.h"
+#include "IndexedTileLayer.h"
+#include "TexturePass.h"
+#include "VertexArray.h"
+
+namespace FA {
+
+namespace Graphic {
+
+void RecordingRenderTarget::draw(const DrawableIf &drawable)
+{
+    const sf::Drawable &sfDrawable = drawable;
+    Command command;
+
+    if (auto sprite = dynamic_cast<const sf::Sprite *>(&sfDrawable)) {
+        command.type_ = CommandType::Sprite;
+        command.texture_ = sprite->getTexture();
+        command.textureRect_ = sprite->getTextureRect();
+        command.transform_ = sprite->getTransform();
+    }
+    else if (auto batch = dynamic_cast<const BatchRenderTarget::Batch *>(&sfDrawable)) {
+        command.type_ = CommandType::Batch;
+        command.texture_ = batch->GetTexture();
+        command.nVertices_ = batch->GetVertexCount();
+    }
+    else if (auto vertexArray = dynamic_cast<const VertexArray *>(&drawable)) {
+        command.type_ = CommandType::VertexArray;
+        command.texture_ = vertexArray->getTexture();
+        command.nVertices_ = vertexArray->getVertexCount();
+    }
+    else if (auto tileLayer = dynamic_cast<const IndexedTileLayer *>(&drawable)) {
+        command.type_ = CommandType::TileLayer;
+        command.texture_ = tileLayer->getTexture();
+    }
+    else if (dynamic_cast<const TexturePass *>(&drawable) != nullptr) {
+        command.type_ = CommandType::TexturePass;  // draws to its own texture, not to this target
+    }
+    else if (auto text = dynamic_cast<const sf::Text *>(&sfDrawable)) {
+        command.type_ = CommandType::Text;
+        command.transform_ = text->getTransform();
+    }
+    else if (auto shape = dynamic_cast<const sf::Shape *>(&sfDrawable)) {
+        command.type_ = CommandType::Shape;
+        command.texture_ = shape->getTexture();
+        command.transform_ = shape->getTransform();
+    }
+    else {
+        command.type_ = CommandType::Other;
+    }
+
+    commands_.push_back(command);
+}
+
+std::size_t RecordingRenderTarget::GetNumberOfDrawCalls(CommandType type) const
+{
+    return std::count_if(commands_.begin(), commands_.end(),
+                         [type](const Command &command) { return command.type_ == type; });
+}
+
+// Consecutive calls without a texture do not count as a switch
+std::size_t RecordingRenderTarget::GetNumberOfTextureSwitches() const
+{
+    std::size_t nSwitches = 0;
+    const void *current = nullptr;
+    for (const auto &command : commands_) {
+        if (command.texture_ != nullptr && command.texture_ != current) {
+            if (current != nullptr) nSwitches++;
+            current = command.texture_;
+        }
+    }
+
+    return nSwitches;
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -71,6 +71,11 @@ void RenderWindow::setView(const sf::View& view)
     renderWindow_->setView(view);
 }
 
+bool RenderWindow::setActive(bool active)
+{
+    return renderWindow_->setActive(active);
+}
+
 }  // namespace Graphic
 
 }  // namespace FA
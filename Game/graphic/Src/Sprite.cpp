@@ -14,25 +14,29 @@ namespace FA {
 
 namespace Graphic {
 
-Sprite::Sprite()
-    : sprite_(std::make_shared<sf::Sprite>())
-{}
-
+// Animations apply the same texture every frame, only cast when it changes
 void Sprite::setTexture(const TextureIf& texture, bool resetRect)
+{
+    if (&texture == texture_ && !resetRect) return;
+
+    setTexture(dynamic_cast<const Texture&>(texture), resetRect);
+}
+
+void Sprite::setTexture(const Texture& texture, bool resetRect)
 {
     texture_ = &texture;
-    const sf::Texture& sfTexture = dynamic_cast<const Texture&>(texture);
-    sprite_->setTexture(sfTexture, resetRect);
+    const sf::Texture& sfTexture = texture;
+    sprite_.setTexture(sfTexture, resetRect);
 }
 
 void Sprite::setTextureRect(const sf::IntRect& rectangle)
 {
-    sprite_->setTextureRect(rectangle);
+    sprite_.setTextureRect(rectangle);
 }
 
 void Sprite::setColor(const sf::Color& color)
 {
-    sprite_->setColor(color);
+    sprite_.setColor(color);
 }
 
 const TextureIf* Sprite::getTexture() const
@@ -42,37 +46,37 @@ const TextureIf* Sprite::getTexture() const
 
 sf::FloatRect Sprite::getLocalBounds() const
 {
-    return sprite_->getLocalBounds();
+    return sprite_.getLocalBounds();
 }
 
 sf::FloatRect Sprite::getGlobalBounds() const
 {
-    return sprite_->getGlobalBounds();
+    return sprite_.getGlobalBounds();
 }
 
 void Sprite::setPosition(float x, float y)
 {
-    sprite_->setPosition(x, y);
+    sprite_.setPosition(x, y);
 }
 
 void Sprite::setPosition(const sf::Vector2f& position)
 {
-    sprite_->setPosition(position);
+    sprite_.setPosition(position);
 }
 
 void Sprite::setRotation(float angle)
 {
-    sprite_->setRotation(angle);
+    sprite_.setRotation(angle);
 }
 
 void Sprite::setOrigin(float x, float y)
 {
-    sprite_->setOrigin(x, y);
+    sprite_.setOrigin(x, y);
 }
 
 Sprite::operator const sf::Drawable&() const
 {
-    return *sprite_;
+    return sprite_;
 }
 
 }  // namespace Graphic
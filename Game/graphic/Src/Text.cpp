@@ -6,6 +6,8 @@
 
 #include "Text.h"
 
+#include <mutex>
+
 #include <SFML/Graphics/Text.hpp>
 
 #include "Font.h"
@@ -39,8 +41,10 @@ void Text::setFillColor(const sf::Color &color)
     text_->setFillColor(color);
 }
 
+// Loads the glyphs of the string
 sf::FloatRect Text::getGlobalBounds() const
 {
+    std::lock_guard<std::mutex> lock(Font::GetGlyphMutex());
     return text_->getGlobalBounds();
 }
 
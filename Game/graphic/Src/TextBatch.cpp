@@ -0,0 +1,146 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "TextBatch.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include "Font.h"
+#include "RenderTargetIf.h"
+#include "Texture.h"
+
+namespace FA {
+
+namespace Graphic {
+
+namespace {
+
+// Same padding as sf::Text, so glyph edges are not cut off
+constexpr float padding = 1.0f;
+
+void AddQuad(VertexArray &vertexArray, const sf::FloatRect &rect, const sf::FloatRect &textureRect,
+             const sf::Color &color)
+{
+    float right = rect.left + rect.width;
+    float bottom = rect.top + rect.height;
+    float u1 = textureRect.left + textureRect.width;
+    float v1 = textureRect.top + textureRect.height;
+    sf::Vertex topLeft({rect.left, rect.top}, color, {textureRect.left, textureRect.top});
+    sf::Vertex topRight({right, rect.top}, color, {u1, textureRect.top});
+    sf::Vertex bottomLeft({rect.left, bottom}, color, {textureRect.left, v1});
+    sf::Vertex bottomRight({right, bottom}, color, {u1, v1});
+
+    vertexArray.append(topLeft);
+    vertexArray.append(topRight);
+    vertexArray.append(bottomRight);
+    vertexArray.append(topLeft);
+    vertexArray.append(bottomRight);
+    vertexArray.append(bottomLeft);
+}
+
+}  // namespace
+
+constexpr std::size_t TextBatch::maxLength;
+
+void TextBatch::Create(const FontIf &font, unsigned int characterSize)
+{
+    const sf::Font &sfFont = dynamic_cast<const Font &>(font);
+    font_ = &sfFont;
+    characterSize_ = characterSize;
+    entries_.clear();
+    texture_.reset();
+    dirty_ = true;
+}
+
+TextBatch::TextId TextBatch::Add(const sf::Vector2f &position, const sf::Color &color)
+{
+    Entry entry;
+    entry.position_ = position;
+    entry.color_ = color;
+    entries_.push_back(entry);
+    dirty_ = true;
+
+    return entries_.size() - 1;
+}
+
+void TextBatch::SetString(TextId id, const std::string &string)
+{
+    Set(id, string.c_str());
+}
+
+void TextBatch::Format(TextId id, const char *format, ...)
+{
+    std::array<char, maxLength> buffer;
+    va_list args;
+    va_start(args, format);
+    std::vsnprintf(buffer.data(), buffer.size(), format, args);
+    va_end(args);
+    Set(id, buffer.data());
+}
+
+void TextBatch::DrawTo(RenderTargetIf &renderTarget)
+{
+    if (font_ == nullptr) return;
+
+    if (dirty_) Build();
+    renderTarget.draw(vertices_);
+}
+
+// Truncated to maxLength - 1 characters
+void TextBatch::Set(TextId id, const char *string)
+{
+    auto &current = entries_[id].string_;
+    if (std::strncmp(current.data(), string, maxLength - 1) == 0) return;
+
+    std::strncpy(current.data(), string, maxLength - 1);
+    current[maxLength - 1] = '\0';
+    dirty_ = true;
+}
+
+void TextBatch::Build()
+{
+    std::lock_guard<std::mutex> lock(Font::GetGlyphMutex());
+    vertices_.clear();
+
+    for (const auto &entry : entries_) {
+        float x = entry.position_.x;
+        float y = entry.position_.y + characterSize_;  // baseline, as in sf::Text
+        sf::Uint32 prev = 0;
+        for (const char *c = entry.string_.data(); *c != '\0'; c++) {
+            sf::Uint32 codePoint = static_cast<unsigned char>(*c);
+            x += font_->getKerning(prev, codePoint, characterSize_);
+            prev = codePoint;
+            const auto &glyph = font_->getGlyph(codePoint, characterSize_, false);
+            if (glyph.bounds.width > 0.0f && glyph.bounds.height > 0.0f) {
+                sf::FloatRect rect(x + glyph.bounds.left - padding, y + glyph.bounds.top - padding,
+                                   glyph.bounds.width + 2 * padding, glyph.bounds.height + 2 * padding);
+                sf::FloatRect textureRect(glyph.textureRect.left - padding, glyph.textureRect.top - padding,
+                                          glyph.textureRect.width + 2 * padding,
+                                          glyph.textureRect.height + 2 * padding);
+                AddQuad(vertices_, rect, textureRect, entry.color_);
+            }
+            x += glyph.advance;
+        }
+    }
+
+    // Glyph page of the character size, fetched after glyphs are loaded since loading can create it
+    if (!texture_) {
+        texture_ = Texture::CreateWrapper(font_->getTexture(characterSize_));
+        vertices_.setTexture(*texture_);
+        vertices_.setGlyphPage(true);
+    }
+    dirty_ = false;
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
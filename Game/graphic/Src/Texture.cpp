@@ -6,9 +6,12 @@
 
 #include "Texture.h"
 
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include "Image.h"
+
 namespace FA {
 
 namespace Graphic {
@@ -47,6 +50,18 @@ bool Texture::loadFromMemory(const void* data, std::size_t size, const sf::IntRe
     return texture_->loadFromMemory(data, size, area);
 }
 
+bool Texture::loadFromImage(const ImageIf& image)
+{
+    const sf::Image& sfImage = dynamic_cast<const Image&>(image);
+    return texture_->loadFromImage(sfImage);
+}
+
+void Texture::update(const ImageIf& image, unsigned int x, unsigned int y)
+{
+    const sf::Image& sfImage = dynamic_cast<const Image&>(image);
+    texture_->update(sfImage, x, y);
+}
+
 sf::Vector2u Texture::getSize() const
 {
     return texture_->getSize();
@@ -0,0 +1,118 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "TexturePass.h"
+
+#include <cassert>
+#include <vector>
+
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include "RenderTexture.h"
+#include "View.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class TexturePass::Pass : public sf::Drawable
+{
+public:
+    enum class Type { Clear, Sprite, Shape };
+
+    Pass(sf::RenderTexture &renderTexture, const sf::View &view)
+        : renderTexture_(&renderTexture)
+        , view_(view)
+    {}
+
+    void AddClear(const sf::Color &color) { Add(Type::Clear, colors_, color); }
+    void Add(const sf::Sprite &sprite) { Add(Type::Sprite, sprites_, sprite); }
+    void Add(const sf::RectangleShape &shape) { Add(Type::Shape, shapes_, shape); }
+
+private:
+    struct Command
+    {
+        Type type_;
+        std::size_t index_;
+    };
+
+    sf::RenderTexture *renderTexture_;
+    sf::View view_;
+    std::vector<Command> commands_;
+    std::vector<sf::Color> colors_;
+    std::vector<sf::Sprite> sprites_;
+    std::vector<sf::RectangleShape> shapes_;
+
+private:
+    template <class T>
+    void Add(Type type, std::vector<T> &items, const T &item)
+    {
+        commands_.push_back({type, items.size()});
+        items.push_back(item);
+    }
+
+    // The target the pass is drawn to is left as it is, only the render texture is drawn to
+    virtual void draw(sf::RenderTarget &, sf::RenderStates states) const override
+    {
+        renderTexture_->setView(view_);
+        for (const auto &command : commands_) {
+            switch (command.type_) {
+                case Type::Clear:
+                    renderTexture_->clear(colors_[command.index_]);
+                    break;
+                case Type::Sprite:
+                    renderTexture_->draw(sprites_[command.index_], states);
+                    break;
+                case Type::Shape:
+                    renderTexture_->draw(shapes_[command.index_], states);
+                    break;
+            }
+        }
+        renderTexture_->display();
+    }
+};
+
+TexturePass::TexturePass(RenderTexture &renderTexture, const View &view)
+    : pass_(std::make_shared<Pass>(*renderTexture.renderTexture_, static_cast<const sf::View &>(view)))
+{}
+
+TexturePass::~TexturePass() = default;
+
+void TexturePass::clear(const sf::Color &color)
+{
+    pass_->AddClear(color);
+}
+
+void TexturePass::draw(const DrawableIf &drawable)
+{
+    const sf::Drawable &sfDrawable = drawable;
+    if (auto sprite = dynamic_cast<const sf::Sprite *>(&sfDrawable)) {
+        pass_->Add(*sprite);
+    }
+    else if (auto shape = dynamic_cast<const sf::RectangleShape *>(&sfDrawable)) {
+        pass_->Add(*shape);
+    }
+    else {
+        assert(false && "Only sprites and rectangle shapes can be drawn to a texture pass");
+    }
+}
+
+std::shared_ptr<const sf::Drawable> TexturePass::GetDrawable() const
+{
+    return pass_;
+}
+
+TexturePass::operator const sf::Drawable &() const
+{
+    return *pass_;
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
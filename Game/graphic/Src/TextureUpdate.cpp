@@ -0,0 +1,61 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "TextureUpdate.h"
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include "Image.h"
+#include "Texture.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class TextureUpdate::Update : public sf::Drawable
+{
+public:
+    Update(sf::Texture &texture, const sf::Image &image, const sf::Vector2u &position)
+        : texture_(&texture)
+        , image_(image)
+        , position_(position)
+    {}
+
+private:
+    sf::Texture *texture_;
+    sf::Image image_;
+    sf::Vector2u position_;
+
+private:
+    // The target the update is drawn to is left as it is, only the texture is written
+    virtual void draw(sf::RenderTarget &, sf::RenderStates) const override
+    {
+        texture_->update(image_, position_.x, position_.y);
+    }
+};
+
+TextureUpdate::TextureUpdate(TextureIf &texture, const ImageIf &image, const sf::Vector2u &position)
+    : update_(std::make_shared<Update>(*dynamic_cast<Texture &>(texture).texture_,
+                                       static_cast<const sf::Image &>(dynamic_cast<const Image &>(image)), position))
+{}
+
+TextureUpdate::~TextureUpdate() = default;
+
+std::shared_ptr<const sf::Drawable> TextureUpdate::GetDrawable() const
+{
+    return update_;
+}
+
+TextureUpdate::operator const sf::Drawable &() const
+{
+    return *update_;
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
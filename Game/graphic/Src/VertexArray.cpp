@@ -0,0 +1,100 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "VertexArray.h"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include "Texture.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class VertexArray::TexturedVertexArray : public sf::Drawable
+{
+public:
+    sf::VertexArray vertices_{sf::Triangles};
+    const sf::Texture *texture_{nullptr};
+    bool isGlyphPage_{false};
+
+private:
+    virtual void draw(sf::RenderTarget &target, sf::RenderStates states) const override
+    {
+        states.texture = texture_;
+        target.draw(vertices_, states);
+    }
+};
+
+VertexArray::VertexArray()
+    : vertexArray_(std::make_shared<TexturedVertexArray>())
+{}
+
+void VertexArray::clear()
+{
+    vertexArray_->vertices_.clear();
+}
+
+void VertexArray::resize(std::size_t vertexCount)
+{
+    vertexArray_->vertices_.resize(vertexCount);
+}
+
+std::size_t VertexArray::getVertexCount() const
+{
+    return vertexArray_->vertices_.getVertexCount();
+}
+
+void VertexArray::append(const sf::Vertex &vertex)
+{
+    vertexArray_->vertices_.append(vertex);
+}
+
+sf::Vertex &VertexArray::operator[](std::size_t index)
+{
+    return vertexArray_->vertices_[index];
+}
+
+sf::FloatRect VertexArray::getBounds() const
+{
+    return vertexArray_->vertices_.getBounds();
+}
+
+void VertexArray::setTexture(const TextureIf &texture)
+{
+    const sf::Texture &sfTexture = dynamic_cast<const Texture &>(texture);
+    vertexArray_->texture_ = &sfTexture;
+}
+
+void VertexArray::setGlyphPage(bool isGlyphPage)
+{
+    vertexArray_->isGlyphPage_ = isGlyphPage;
+}
+
+VertexArray::operator const sf::Drawable &() const
+{
+    return *vertexArray_;
+}
+
+const sf::Texture *VertexArray::getTexture() const
+{
+    return vertexArray_->texture_;
+}
+
+const sf::VertexArray &VertexArray::getVertices() const
+{
+    return vertexArray_->vertices_;
+}
+
+bool VertexArray::isGlyphPage() const
+{
+    return vertexArray_->isGlyphPage_;
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -31,6 +31,11 @@ void View::setCenter(const sf::Vector2f& center)
     view_->setCenter(center);
 }
 
+void View::setViewport(const sf::FloatRect& viewport)
+{
+    view_->setViewport(viewport);
+}
+
 }  // namespace Graphic
 
 }  // namespace FA
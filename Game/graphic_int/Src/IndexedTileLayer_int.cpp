@@ -0,0 +1,208 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include "Image.h"
+#include "IndexedTileLayer.h"
+#include "RenderTexture.h"
+#include "Sprite.h"
+#include "Texture.h"
+#include "View.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Graphic {
+
+/* Draws the same tiles baked, one sprite per tile, and indexed, and expects identical pixels */
+class IndexedTileLayerInt : public Test
+{
+protected:
+    struct Tile
+    {
+        sf::Vector2u cell_;
+        sf::Vector2u tilesetPosition_;
+    };
+
+    void SetUp() override
+    {
+        if (!IndexedTileLayer::isAvailable()) GTEST_SKIP() << "Shaders are not available";
+
+        // every pixel in the tileset has its own color, so a pixel from a wrong tile or row shows
+        std::vector<std::uint8_t> pixels;
+        for (unsigned int y = 0; y < tilesetSize_.y; y++) {
+            for (unsigned int x = 0; x < tilesetSize_.x; x++) {
+                pixels.insert(pixels.end(), {static_cast<std::uint8_t>(8 * x), static_cast<std::uint8_t>(8 * y),
+                                             static_cast<std::uint8_t>(255 - 4 * (x + y)), 255});
+            }
+        }
+        Image image;
+        image.create(tilesetSize_.x, tilesetSize_.y, pixels.data());
+        ASSERT_TRUE(tileset_.loadFromImage(image));
+    }
+
+    void DrawBaked(RenderTexture &renderTexture, const std::vector<Tile> &tiles) const
+    {
+        Sprite sprite;
+        for (const auto &tile : tiles) {
+            sprite.setTexture(tileset_);
+            sprite.setTextureRect({static_cast<int>(tile.tilesetPosition_.x),
+                                   static_cast<int>(tile.tilesetPosition_.y), static_cast<int>(tileSize_.x),
+                                   static_cast<int>(tileSize_.y)});
+            sprite.setPosition(static_cast<float>(tile.cell_.x * tileSize_.x),
+                               static_cast<float>(tile.cell_.y * tileSize_.y));
+            renderTexture.draw(sprite);
+        }
+    }
+
+    void CreateIndexed(IndexedTileLayer &layer, const std::vector<Tile> &tiles) const
+    {
+        ASSERT_TRUE(layer.create(gridSize_, tileSize_, tileset_));
+        for (const auto &tile : tiles) {
+            layer.setTile(tile.cell_, tile.tilesetPosition_);
+        }
+        layer.update();
+    }
+
+    void Render(RenderTexture &renderTexture, const View &view) const
+    {
+        ASSERT_TRUE(renderTexture.create(outputSize_.x, outputSize_.y));
+        renderTexture.setView(view);
+        renderTexture.clear(sf::Color::Black);
+    }
+
+    std::vector<std::uint8_t> GetPixels(RenderTexture &renderTexture) const
+    {
+        renderTexture.display();
+        Image image;
+        image.loadFromTexture(renderTexture.getTexture());
+        const auto *pixels = image.getPixelsPtr();
+        return {pixels, pixels + 4 * outputSize_.x * outputSize_.y};
+    }
+
+    View GetView(float zoom) const
+    {
+        View view;
+        view.setSize(static_cast<sf::Vector2f>(outputSize_));
+        view.setCenter(static_cast<sf::Vector2f>(outputSize_) / 2.0f);
+        view.zoom(zoom);
+        return view;
+    }
+
+    const sf::Vector2u tileSize_{4, 4};
+    const sf::Vector2u gridSize_{4, 3};
+    const sf::Vector2u tilesetSize_{12, 8};
+    const sf::Vector2u outputSize_{16, 12};
+    const std::vector<Tile> tiles_{{{0, 0}, {0, 0}}, {{1, 0}, {4, 0}}, {{2, 0}, {8, 4}}, {{0, 1}, {4, 4}},
+                                   {{3, 1}, {0, 4}}, {{1, 2}, {8, 0}}, {{3, 2}, {4, 0}}};  // some cells are empty
+    Texture tileset_;
+};
+
+TEST_F(IndexedTileLayerInt, ShouldDrawSamePixelsAsBakedTiles)
+{
+    RenderTexture baked;
+    Render(baked, GetView(1.0f));
+    DrawBaked(baked, tiles_);
+
+    IndexedTileLayer layer;
+    CreateIndexed(layer, tiles_);
+    RenderTexture indexed;
+    Render(indexed, GetView(1.0f));
+    indexed.draw(layer);
+
+    EXPECT_THAT(GetPixels(indexed), ContainerEq(GetPixels(baked)));
+}
+
+TEST_F(IndexedTileLayerInt, ShouldDrawSamePixelsAsBakedTilesWhenZoomed)
+{
+    RenderTexture baked;
+    Render(baked, GetView(0.5f));
+    DrawBaked(baked, tiles_);
+
+    IndexedTileLayer layer;
+    CreateIndexed(layer, tiles_);
+    RenderTexture indexed;
+    Render(indexed, GetView(0.5f));
+    indexed.draw(layer);
+
+    EXPECT_THAT(GetPixels(indexed), ContainerEq(GetPixels(baked)));
+}
+
+TEST_F(IndexedTileLayerInt, ShouldDrawSamePixelsAsBakedTilesAfterTileIsChanged)
+{
+    IndexedTileLayer layer;
+    CreateIndexed(layer, tiles_);
+    layer.setTile({2, 2}, {0, 0});
+    layer.clearTile({0, 0});
+    layer.update();
+    RenderTexture indexed;
+    Render(indexed, GetView(1.0f));
+    indexed.draw(layer);
+
+    auto tiles = tiles_;
+    tiles.erase(tiles.begin());
+    tiles.push_back({{2, 2}, {0, 0}});
+    RenderTexture baked;
+    Render(baked, GetView(1.0f));
+    DrawBaked(baked, tiles);
+
+    EXPECT_THAT(GetPixels(indexed), ContainerEq(GetPixels(baked)));
+}
+
+TEST_F(IndexedTileLayerInt, ShouldUploadSingleChangedTile)
+{
+    IndexedTileLayer layer;
+    CreateIndexed(layer, tiles_);
+    layer.setTile({3, 0}, {8, 4});
+    layer.update();
+    RenderTexture indexed;
+    Render(indexed, GetView(1.0f));
+    indexed.draw(layer);
+
+    auto tiles = tiles_;
+    tiles.push_back({{3, 0}, {8, 4}});
+    RenderTexture baked;
+    Render(baked, GetView(1.0f));
+    DrawBaked(baked, tiles);
+
+    EXPECT_THAT(GetPixels(indexed), ContainerEq(GetPixels(baked)));
+}
+
+TEST_F(IndexedTileLayerInt, ShouldUploadAllUpdatesWhenDrawn)
+{
+    IndexedTileLayer layer;
+    CreateIndexed(layer, tiles_);
+    layer.setTile({3, 0}, {8, 4});
+    layer.update();
+    layer.clearTile({0, 0});
+    layer.setTile({2, 2}, {0, 0});
+    layer.update();
+    RenderTexture indexed;
+    Render(indexed, GetView(1.0f));
+    indexed.draw(layer);
+
+    std::vector<Tile> tiles(tiles_.begin() + 1, tiles_.end());
+    tiles.push_back({{3, 0}, {8, 4}});
+    tiles.push_back({{2, 2}, {0, 0}});
+    RenderTexture baked;
+    Render(baked, GetView(1.0f));
+    DrawBaked(baked, tiles);
+
+    EXPECT_THAT(GetPixels(indexed), ContainerEq(GetPixels(baked)));
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,132 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "BatchRenderTarget.h"
+#include "RecordingRenderTarget.h"
+#include "RectangleShape.h"
+#include "Sprite.h"
+#include "Texture.h"
+#include "VertexArray.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Graphic {
+
+/* Draws a synthetic level the way Level::Draw does, batched, and checks the recorded draw calls, so
+ * a change that breaks batching shows without a window. Textures are never created, the recorder
+ * only keeps them as identities.
+ */
+class RecordingRenderTargetInt : public Test
+{
+protected:
+    using CommandType = RecordingRenderTarget::CommandType;
+
+    void DrawTiles(const Texture &texture, const sf::Vector2u &gridSize)
+    {
+        Sprite sprite;
+        sprite.setTexture(texture);
+        sprite.setTextureRect({0, 0, tileSize_, tileSize_});
+        for (unsigned int y = 0; y < gridSize.y; y++) {
+            for (unsigned int x = 0; x < gridSize.x; x++) {
+                sprite.setPosition(static_cast<float>(x * tileSize_), static_cast<float>(y * tileSize_));
+                batchRenderTarget_.draw(sprite);
+            }
+        }
+    }
+
+    void DrawEntities(unsigned int nEntities)
+    {
+        Sprite sprite;
+        sprite.setTexture(entitySheet_);
+        sprite.setTextureRect({0, 0, tileSize_, tileSize_});
+        for (unsigned int i = 0; i < nEntities; i++) {
+            sprite.setPosition(static_cast<float>(i * tileSize_), 0.0f);
+            batchRenderTarget_.draw(sprite);
+        }
+    }
+
+    const int tileSize_{16};
+    Texture tileset_;
+    Texture entitySheet_;
+    BatchRenderTarget batchRenderTarget_;
+    RecordingRenderTarget renderTarget_;
+};
+
+TEST_F(RecordingRenderTargetInt, TilesSharingTextureShouldBeOneBatch)
+{
+    batchRenderTarget_.Begin(renderTarget_);
+    DrawTiles(tileset_, {4, 3});
+    batchRenderTarget_.End();
+
+    ASSERT_THAT(renderTarget_.GetNumberOfDrawCalls(), Eq(1u));
+    EXPECT_THAT(renderTarget_.GetNumberOfDrawCalls(CommandType::Batch), Eq(1u));
+    EXPECT_THAT(renderTarget_.GetNumberOfTextureSwitches(), Eq(0u));
+    EXPECT_THAT(renderTarget_.GetCommands()[0].nVertices_, Eq(4u * 3u * 6u));
+}
+
+TEST_F(RecordingRenderTargetInt, LevelShouldBeOneBatchPerTextureChange)
+{
+    VertexArray animatedTiles;
+    animatedTiles.setTexture(tileset_);
+    for (int i = 0; i < 6; i++) {
+        animatedTiles.append(sf::Vertex());
+    }
+
+    batchRenderTarget_.Begin(renderTarget_);
+    DrawTiles(tileset_, {8, 8});  // background
+    DrawEntities(5);
+    DrawTiles(tileset_, {8, 1});  // fringe
+    batchRenderTarget_.draw(animatedTiles);
+    batchRenderTarget_.End();
+
+    EXPECT_THAT(renderTarget_.GetNumberOfDrawCalls(), Eq(4u));
+    EXPECT_THAT(renderTarget_.GetNumberOfDrawCalls(CommandType::Batch), Eq(3u));
+    EXPECT_THAT(renderTarget_.GetNumberOfDrawCalls(CommandType::VertexArray), Eq(1u));
+    EXPECT_THAT(renderTarget_.GetNumberOfTextureSwitches(), Eq(2u));
+}
+
+TEST_F(RecordingRenderTargetInt, ShapeShouldSplitBatchWithoutTextureSwitch)
+{
+    RectangleShape shape;
+    shape.setSize({8.0f, 8.0f});
+
+    batchRenderTarget_.Begin(renderTarget_);
+    DrawTiles(tileset_, {2, 2});
+    batchRenderTarget_.draw(shape);
+    DrawTiles(tileset_, {2, 2});
+    batchRenderTarget_.End();
+
+    EXPECT_THAT(renderTarget_.GetNumberOfDrawCalls(), Eq(3u));
+    EXPECT_THAT(renderTarget_.GetNumberOfDrawCalls(CommandType::Batch), Eq(2u));
+    EXPECT_THAT(renderTarget_.GetNumberOfDrawCalls(CommandType::Shape), Eq(1u));
+    EXPECT_THAT(renderTarget_.GetNumberOfTextureSwitches(), Eq(0u));
+}
+
+TEST_F(RecordingRenderTargetInt, DrawnSpritesShouldNotBeBatchedWithoutBatchRenderTarget)
+{
+    Sprite sprite;
+    sprite.setTexture(tileset_);
+    renderTarget_.draw(sprite);
+    renderTarget_.draw(sprite);
+    sprite.setTexture(entitySheet_);
+    renderTarget_.draw(sprite);
+
+    EXPECT_THAT(renderTarget_.GetNumberOfDrawCalls(CommandType::Sprite), Eq(3u));
+    EXPECT_THAT(renderTarget_.GetNumberOfTextureSwitches(), Eq(1u));
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,85 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "Image.h"
+#include "RectangleShape.h"
+#include "RenderTexture.h"
+#include "TexturePass.h"
+#include "View.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Graphic {
+
+class TexturePassInt : public Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(texture_.create(size_.x, size_.y));
+        ASSERT_TRUE(target_.create(size_.x, size_.y));
+        texture_.clear(sf::Color::Black);
+        texture_.display();
+
+        view_.setSize(static_cast<sf::Vector2f>(size_));
+        view_.setCenter(static_cast<sf::Vector2f>(size_) / 2.0f);
+    }
+
+    std::vector<std::uint8_t> GetPixels(RenderTexture &renderTexture) const
+    {
+        Image image;
+        image.loadFromTexture(renderTexture.getTexture());
+        const auto *pixels = image.getPixelsPtr();
+        return {pixels, pixels + 4 * size_.x * size_.y};
+    }
+
+    std::vector<std::uint8_t> GetPixels(const sf::Color &color) const
+    {
+        std::vector<std::uint8_t> pixels;
+        for (unsigned int i = 0; i < size_.x * size_.y; i++) {
+            pixels.insert(pixels.end(), {color.r, color.g, color.b, color.a});
+        }
+        return pixels;
+    }
+
+    const sf::Vector2u size_{8, 4};
+    RenderTexture texture_;
+    RenderTexture target_;
+    View view_;
+};
+
+TEST_F(TexturePassInt, ShouldDrawToTextureWhenPassIsDrawn)
+{
+    TexturePass pass(texture_, view_);
+    pass.clear(sf::Color::Red);
+    RectangleShape shape;
+    shape.setSize({4.0f, 4.0f});
+    shape.setFillColor(sf::Color::Blue);
+    pass.draw(shape);
+
+    EXPECT_THAT(GetPixels(texture_), ContainerEq(GetPixels(sf::Color::Black)));
+
+    target_.draw(pass);
+
+    auto pixels = GetPixels(texture_);
+    EXPECT_THAT(std::vector<std::uint8_t>(pixels.begin(), pixels.begin() + 4), ElementsAre(0, 0, 255, 255));
+    EXPECT_THAT(std::vector<std::uint8_t>(pixels.end() - 4, pixels.end()), ElementsAre(255, 0, 0, 255));
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -0,0 +1,91 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "DrawList.h"
+#include "Image.h"
+#include "RenderTexture.h"
+#include "Texture.h"
+#include "TextureUpdate.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Graphic {
+
+class TextureUpdateInt : public Test
+{
+protected:
+    void SetUp() override
+    {
+        Image black;
+        black.create(size_.x, size_.y, GetPixels(sf::Color::Black, size_).data());
+        ASSERT_TRUE(texture_.loadFromImage(black));
+        ASSERT_TRUE(target_.create(size_.x, size_.y));
+        red_.create(4, 4, GetPixels(sf::Color::Red, {4, 4}).data());
+    }
+
+    std::vector<std::uint8_t> GetPixels(const TextureIf &texture) const
+    {
+        Image image;
+        image.loadFromTexture(texture);
+        const auto *pixels = image.getPixelsPtr();
+        return {pixels, pixels + 4 * size_.x * size_.y};
+    }
+
+    static std::vector<std::uint8_t> GetPixels(const sf::Color &color, const sf::Vector2u &size)
+    {
+        std::vector<std::uint8_t> pixels;
+        for (unsigned int i = 0; i < size.x * size.y; i++) {
+            pixels.insert(pixels.end(), {color.r, color.g, color.b, color.a});
+        }
+        return pixels;
+    }
+
+    const sf::Vector2u size_{8, 4};
+    Texture texture_;
+    RenderTexture target_;
+    Image red_;
+};
+
+TEST_F(TextureUpdateInt, ShouldWriteTextureWhenUpdateIsDrawn)
+{
+    TextureUpdate update(texture_, red_, {4, 0});
+
+    EXPECT_THAT(GetPixels(texture_), ContainerEq(GetPixels(sf::Color::Black, size_)));
+
+    target_.draw(update);
+
+    auto pixels = GetPixels(texture_);
+    EXPECT_THAT(std::vector<std::uint8_t>(pixels.begin(), pixels.begin() + 4), ElementsAre(0, 0, 0, 255));
+    EXPECT_THAT(std::vector<std::uint8_t>(pixels.end() - 4, pixels.end()), ElementsAre(255, 0, 0, 255));
+}
+
+TEST_F(TextureUpdateInt, ShouldWriteTextureWhenDrawListIsDrawn)
+{
+    DrawList drawList;
+    drawList.draw(TextureUpdate(texture_, red_, {4, 0}));
+
+    EXPECT_THAT(GetPixels(texture_), ContainerEq(GetPixels(sf::Color::Black, size_)));
+
+    target_.draw(drawList);
+
+    auto pixels = GetPixels(texture_);
+    EXPECT_THAT(std::vector<std::uint8_t>(pixels.end() - 4, pixels.end()), ElementsAre(255, 0, 0, 255));
+}
+
+}  // namespace Graphic
+
+}  // namespace FA
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 
@@ -15,7 +16,7 @@ namespace FA {
 
 namespace Graphic {
 
-class RenderTargetIf;
+class DrawList;
 
 }  // namespace Graphic
 
@@ -43,7 +44,9 @@ public:
         bool isRunning_ = true;
     };
 
-    Manager(Shared::MessageBus& messageBus, Shared::TextureManager& textureManager);
+    // beforeSwitchFn is called before the current scene and its layers can be destroyed
+    Manager(Shared::MessageBus& messageBus, Shared::TextureManager& textureManager,
+            std::function<void()> beforeSwitchFn = [] {});
     ~Manager();
 
     template <class SceneT, class TransitionT>
@@ -59,12 +62,13 @@ public:
 
     void SetScene(std::unique_ptr<BasicScene> newScene);
 
-    void DrawTo(Graphic::RenderTargetIf& renderTarget);
+    void DrawTo(Graphic::DrawList& drawList);
     void Update(float deltaTime);
 
     bool IsRunning() const;
 
 private:
+    std::function<void()> beforeSwitchFn_;
     std::unique_ptr<BasicScene> currentScene_;
     Data data_;
     Layers layers_;
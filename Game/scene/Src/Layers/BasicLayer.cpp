@@ -9,7 +9,9 @@
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Rect.hpp>
 
+#include "DrawList.h"
 #include "Message/MessageBus.h"
+#include "Transitions/BasicTransition.h"
 
 namespace FA {
 
@@ -25,15 +27,30 @@ BasicLayer::BasicLayer(Shared::MessageBus& messageBus, const sf::IntRect& rect)
 
 BasicLayer::~BasicLayer() = default;
 
-void BasicLayer::Clear()
+void BasicLayer::DrawTo(Graphic::DrawList& drawList)
 {
-    layerTexture_.clear(sf::Color::Transparent);
+    if (!IsIsolated()) {
+        Draw(drawList);
+        return;
+    }
+
+    if (dirty_ || IsRedrawnEveryFrame()) Redraw(drawList, nullptr);
+    drawList.draw(sprite_);
 }
 
-void BasicLayer::DrawTo(Graphic::RenderTargetIf& renderTarget)
+void BasicLayer::DrawTo(Graphic::DrawList& drawList, const BasicTransition& transition)
 {
-    layerTexture_.display();
-    renderTarget.draw(sprite_);
+    if (!IsIsolated()) {
+        Draw(drawList);
+        drawList.ResetView();
+        DrawTransition(drawList, transition);
+        return;
+    }
+
+    // transition changes every frame, and must not be left in the texture afterwards
+    Redraw(drawList, &transition);
+    dirty_ = true;
+    drawList.draw(sprite_);
 }
 
 void BasicLayer::Subscribe(const std::vector<Shared::MessageType>& messageTypes)
@@ -47,6 +64,19 @@ void BasicLayer::Unsubscribe(const std::vector<Shared::MessageType>& messageType
     messageBus_.RemoveSubscriber(Name(), messageTypes);
 }
 
+// Layer texture is only touched by the thread drawing the list
+void BasicLayer::Redraw(Graphic::DrawList& drawList, const BasicTransition* transition)
+{
+    drawList.BeginTexture(layerTexture_, sf::Color::Transparent);
+    Draw(drawList);
+    if (transition != nullptr) {
+        drawList.ResetView();
+        DrawTransition(drawList, *transition);
+    }
+    drawList.EndTexture();
+    dirty_ = false;
+}
+
 }  // namespace Scene
 
 }  // namespace FA
@@ -19,7 +19,7 @@ namespace FA {
 
 namespace Graphic {
 
-class RenderTargetIf;
+class DrawList;
 
 }  // namespace Graphic
 
@@ -44,18 +44,20 @@ public:
     virtual std::string Name() const = 0;
     virtual LayerId GetId() const = 0;
     virtual void Update(float deltaTime) = 0;
-    virtual void Draw() = 0;
+    virtual void Draw(Graphic::DrawList& drawList) = 0;
     virtual void EnableInput(bool enable) = 0;
     virtual void EnterTransition(BasicTransition& transition) {}
     virtual void ExitTransition(BasicTransition& transition) {}
-    virtual void DrawTransition(const BasicTransition& transition) {}
+    virtual void DrawTransition(Graphic::DrawList& drawList, const BasicTransition& transition) {}
     virtual void OnLoad() {}
+    virtual bool IsLoaded() { return true; }  // polled after OnLoad, OnCreate is called once it is true
+    virtual float GetLoadProgress() const { return 1.0f; }
     virtual void OnCreate() {}
     virtual void SubscribeMessages() {}
     virtual void UnsubscribeMessages() {}
 
-    void Clear();
-    void DrawTo(Graphic::RenderTargetIf& renderTarget);
+    void DrawTo(Graphic::DrawList& drawList);
+    void DrawTo(Graphic::DrawList& drawList, const BasicTransition& transition);
 
 protected:
     Graphic::RenderTexture layerTexture_;
@@ -63,10 +65,20 @@ protected:
 protected:
     void Subscribe(const std::vector<Shared::MessageType>& messageTypes);
     void Unsubscribe(const std::vector<Shared::MessageType>& messageTypes);
+    void SetDirty() { dirty_ = true; }
 
 private:
     Graphic::Sprite sprite_;
     Shared::MessageBus& messageBus_;
+    bool dirty_ = true;
+
+private:
+    // Isolated layers are drawn to layerTexture_ which is then composited, others draw straight to the scene target
+    // in window coordinates
+    virtual bool IsIsolated() const { return true; }
+    // Layers that are not redrawn every frame keep their layerTexture_ until SetDirty is called
+    virtual bool IsRedrawnEveryFrame() const { return true; }
+    void Redraw(Graphic::DrawList& drawList, const BasicTransition* transition);
 
 private:
     virtual void OnMessage(std::shared_ptr<Shared::Message> msg) {}
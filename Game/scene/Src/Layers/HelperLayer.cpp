@@ -6,25 +6,85 @@
 
 #include "HelperLayer.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <SFML/Graphics/Color.hpp>
-#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 
+#include "DrawList.h"
 #include "Folder.h"
 #include "Logging.h"
 #include "Message/BroadcastMessage/EntityCreatedMessage.h"
 #include "Message/BroadcastMessage/EntityDestroyedMessage.h"
 #include "Message/MessageBus.h"
 #include "Message/MessageType.h"
+#include "Profiler.h"
 
 namespace FA {
 
 namespace Scene {
 
+namespace {
+
+constexpr std::size_t nGraphFrames = 240;
+constexpr float barWidth = 2.0f;
+constexpr float graphHeight = 100.0f;
+constexpr float graphMaxMs = 50.0f;
+constexpr float pixelsPerMs = graphHeight / graphMaxMs;
+constexpr std::size_t nBuckets = 50;  // 1 ms each, the last one also collects everything slower
+constexpr float bucketWidth = 4.0f;
+constexpr float histogramOffset = nGraphFrames * barWidth + 20.0f;
+
+// Bottom to top in the stacked bars. Collision runs inside Update and is subtracted from it.
+namespace Phase {
+
+enum { Input, Update, Collision, Draw, Display, Count };
+
+}  // namespace Phase
+
+const sf::Color phaseColors[Phase::Count] = {sf::Color::Cyan, sf::Color::Green, sf::Color::Yellow,
+                                               sf::Color::Magenta, sf::Color(80, 80, 255)};
+
+void AddQuad(Graphic::VertexArray& vertexArray, float left, float top, float width, float height,
+             const sf::Color& color)
+{
+    sf::Vertex topLeft({left, top}, color);
+    sf::Vertex topRight({left + width, top}, color);
+    sf::Vertex bottomLeft({left, top + height}, color);
+    sf::Vertex bottomRight({left + width, top + height}, color);
+
+    vertexArray.append(topLeft);
+    vertexArray.append(topRight);
+    vertexArray.append(bottomRight);
+    vertexArray.append(topLeft);
+    vertexArray.append(bottomRight);
+    vertexArray.append(bottomLeft);
+}
+
+float Percentile(std::vector<float> samples, float p)
+{
+    if (samples.empty()) return 0.0f;
+    auto index = static_cast<std::size_t>(std::ceil(p * samples.size())) - 1;
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+// Last nGraphFrames samples of a scope, aligned so that the newest frame is last
+std::vector<float> GetPhaseSamples(const std::string& scope)
+{
+    auto samples = Util::Profiler::Instance().GetSamples(scope);
+    if (samples.size() > nGraphFrames) samples.erase(samples.begin(), samples.end() - nGraphFrames);
+    samples.insert(samples.begin(), nGraphFrames - samples.size(), 0.0f);
+    return samples;
+}
+
+}  // namespace
+
 HelperLayer::HelperLayer(Shared::MessageBus& messageBus, const sf::IntRect& rect, const std::string& sceneName)
     : BasicLayer(messageBus, rect)
     , sceneName_(sceneName)
+    , frameTimes_(nGraphFrames)
 {}
 
 HelperLayer::~HelperLayer() = default;
@@ -39,43 +99,22 @@ void HelperLayer::OnLoad()
 
 void HelperLayer::OnCreate()
 {
-    sceneText_.setFont(font_);
-    sceneText_.setString(sceneName_);
-    sceneText_.setCharacterSize(24);
-    sceneText_.setFillColor(sf::Color::White);
-    sf::Vector2f sceneTextPos(0.0f, 0.0f);
-    sceneText_.setPosition(sceneTextPos);
-
-    fpsText_.setFont(font_);
-    fpsText_.setString("Fps:");
-    fpsText_.setCharacterSize(24);
-    fpsText_.setFillColor(sf::Color::White);
-    sf::Vector2f fpsTextPos(1170.0f, 0.0f);
-    fpsText_.setPosition(fpsTextPos);
-
-    fpsNumberText_.setFont(font_);
-    fpsNumberText_.setString("-");
-    fpsNumberText_.setCharacterSize(24);
-    fpsNumberText_.setFillColor(sf::Color::White);
-    sf::Vector2f fpsNumberTextPos(1220.0f, 0.0f);
-    fpsNumberText_.setPosition(fpsNumberTextPos);
-
-    nEntitiesText_.setFont(font_);
-    nEntitiesText_.setString("Entities count:");
-    nEntitiesText_.setCharacterSize(24);
-    nEntitiesText_.setFillColor(sf::Color::White);
-    sf::Vector2f nEntitiesTextPos(0.0f, 50.0f);
-    nEntitiesText_.setPosition(nEntitiesTextPos);
-
-    nEntitiesCountText_.setFont(font_);
-    nEntitiesCountText_.setString("0");
-    nEntitiesCountText_.setCharacterSize(24);
-    nEntitiesCountText_.setFillColor(sf::Color::White);
-    sf::Vector2f nEntitiesCountTextPos(180.0f, 50.0f);
-    nEntitiesCountText_.setPosition(nEntitiesCountTextPos);
+    texts_.Create(font_, 24);
+    auto sceneText = texts_.Add({0.0f, 0.0f}, sf::Color::White);
+    texts_.SetString(sceneText, sceneName_);
+    auto frameTimeText = texts_.Add({1000.0f, 0.0f}, sf::Color::White);
+    texts_.SetString(frameTimeText, "p50/p99 ms:");
+    frameTimeNumberText_ = texts_.Add({1140.0f, 0.0f}, sf::Color::White);
+    texts_.SetString(frameTimeNumberText_, "-");
+    auto nEntitiesText = texts_.Add({0.0f, 50.0f}, sf::Color::White);
+    texts_.SetString(nEntitiesText, "Entities count:");
+    nEntitiesCountText_ = texts_.Add({180.0f, 50.0f}, sf::Color::White);
+    texts_.SetString(nEntitiesCountText_, "0");
 
     dotShape_.setSize(sf::Vector2f(1.0, 1.0));
     dotShape_.setPosition(layerTexture_.getSize().x / 2.0f, layerTexture_.getSize().y / 2.0f);
+
+    graphPos_ = sf::Vector2f(10.0f, layerTexture_.getSize().y - graphHeight - 10.0f);
 }
 
 void HelperLayer::SubscribeMessages()
@@ -88,21 +127,25 @@ void HelperLayer::UnsubscribeMessages()
     Unsubscribe({Shared::MessageType::EntityInitialized, Shared::MessageType::EntityDestroyed});
 }
 
-void HelperLayer::Draw()
+void HelperLayer::Draw(Graphic::DrawList& drawList)
 {
-    layerTexture_.draw(sceneText_);
-    layerTexture_.draw(fpsText_);
-    layerTexture_.draw(fpsNumberText_);
-    layerTexture_.draw(nEntitiesText_);
-    layerTexture_.draw(nEntitiesCountText_);
-    layerTexture_.draw(dotShape_);
+    texts_.DrawTo(drawList);
+    drawList.draw(dotShape_);
+    drawList.draw(graph_);
 }
 
 void HelperLayer::Update(float deltaTime)
 {
-    unsigned int fps = static_cast<unsigned int>(std::floor(1.0f / deltaTime));
-    fpsNumberText_.setString(std::to_string(fps));
-    nEntitiesCountText_.setString(std::to_string(nEntities_));
+    frameTimes_[frameIndex_] = deltaTime * 1000.0f;
+    frameIndex_ = (frameIndex_ + 1) % nGraphFrames;
+    nFrameTimes_ = std::min(nFrameTimes_ + 1, nGraphFrames);
+
+    auto frameTimes = GetFrameTimes();
+    // Text geometry is only rebuilt when the formatted value changes
+    texts_.Format(frameTimeNumberText_, "%.1f / %.1f", Percentile(frameTimes, 0.5f), Percentile(frameTimes, 0.99f));
+    texts_.Format(nEntitiesCountText_, "%u", nEntities_);
+
+    BuildGraph(frameTimes);
 }
 
 void HelperLayer::OnMessage(std::shared_ptr<Shared::Message> msg)
@@ -115,6 +158,69 @@ void HelperLayer::OnMessage(std::shared_ptr<Shared::Message> msg)
     }
 }
 
+std::vector<float> HelperLayer::GetFrameTimes() const
+{
+    std::vector<float> frameTimes;
+    auto first = (frameIndex_ + nGraphFrames - nFrameTimes_) % nGraphFrames;
+    for (std::size_t i = 0; i < nFrameTimes_; i++) {
+        frameTimes.push_back(frameTimes_[(first + i) % nGraphFrames]);
+    }
+
+    return frameTimes;
+}
+
+// Everything goes into one vertex array, so the graph is a single draw call
+void HelperLayer::BuildGraph(const std::vector<float>& frameTimes)
+{
+    graph_.clear();
+    float bottom = graphPos_.y + graphHeight;
+    AddQuad(graph_, graphPos_.x, graphPos_.y, histogramOffset + nBuckets * bucketWidth, graphHeight,
+            sf::Color(0, 0, 0, 160));
+    for (float ms : {1000.0f / 60.0f, 1000.0f / 30.0f}) {
+        AddQuad(graph_, graphPos_.x, bottom - ms * pixelsPerMs, nGraphFrames * barWidth, 1.0f,
+                sf::Color(128, 128, 128));
+    }
+
+    // Frame time as a grey bar, with the profiled phases stacked on top of it
+    auto offset = nGraphFrames - frameTimes.size();
+    for (std::size_t i = 0; i < frameTimes.size(); i++) {
+        float height = std::min(frameTimes[i], graphMaxMs) * pixelsPerMs;
+        AddQuad(graph_, graphPos_.x + (offset + i) * barWidth, bottom - height, barWidth, height,
+                sf::Color(160, 160, 160));
+    }
+
+    std::vector<float> phases[Phase::Count] = {
+        GetPhaseSamples("Input"), GetPhaseSamples("Update"), GetPhaseSamples("CollisionHandler::DetectCollisions"),
+        GetPhaseSamples("Draw"), GetPhaseSamples("Display")};
+    auto handleCollisions = GetPhaseSamples("CollisionHandler::HandleCollisions");
+    for (std::size_t i = 0; i < nGraphFrames; i++) {
+        phases[Phase::Collision][i] += handleCollisions[i];
+        phases[Phase::Update][i] = std::max(0.0f, phases[Phase::Update][i] - phases[Phase::Collision][i]);
+        float stacked = 0.0f;
+        for (int phase = 0; phase < Phase::Count; phase++) {
+            float ms = std::min(phases[phase][i], graphMaxMs - stacked);
+            if (ms <= 0.0f) continue;
+            stacked += ms;
+            AddQuad(graph_, graphPos_.x + i * barWidth, bottom - stacked * pixelsPerMs, barWidth, ms * pixelsPerMs,
+                    phaseColors[phase]);
+        }
+    }
+
+    // Distribution of frame times, the p99 bucket is marked in red
+    std::vector<unsigned int> buckets(nBuckets);
+    for (float ms : frameTimes) {
+        buckets[std::min(static_cast<std::size_t>(ms), nBuckets - 1)]++;
+    }
+    auto maxCount = std::max(1u, *std::max_element(buckets.begin(), buckets.end()));
+    auto p99Bucket = std::min(static_cast<std::size_t>(Percentile(frameTimes, 0.99f)), nBuckets - 1);
+    for (std::size_t i = 0; i < nBuckets; i++) {
+        float height = graphHeight * buckets[i] / maxCount;
+        auto color = i == p99Bucket ? sf::Color::Red : sf::Color::White;
+        AddQuad(graph_, graphPos_.x + histogramOffset + i * bucketWidth, bottom - height, bucketWidth - 1.0f, height,
+                color);
+    }
+}
+
 }  // namespace Scene
 
 }  // namespace FA
@@ -7,10 +7,14 @@
 #pragma once
 
 #include <string>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
 
 #include "Font.h"
 #include "RectangleShape.h"
-#include "Text.h"
+#include "TextBatch.h"
+#include "VertexArray.h"
 
 #include "BasicLayer.h"
 
@@ -27,7 +31,7 @@ public:
     virtual std::string Name() const override { return "Helper"; }
     virtual LayerId GetId() const override { return LayerId::Helper; }
     virtual void Update(float deltaTime) override;
-    virtual void Draw() override;
+    virtual void Draw(Graphic::DrawList& drawList) override;
     virtual void EnableInput(bool enable) override {}
     virtual void OnLoad() override;
     virtual void OnCreate() override;
@@ -37,16 +41,22 @@ public:
 private:
     Graphic::RectangleShape dotShape_;
     Graphic::Font font_;
-    Graphic::Text sceneText_;
-    Graphic::Text fpsText_;
-    Graphic::Text fpsNumberText_;
-    Graphic::Text nEntitiesText_;
-    Graphic::Text nEntitiesCountText_;
+    Graphic::TextBatch texts_;
+    Graphic::TextBatch::TextId frameTimeNumberText_{};
+    Graphic::TextBatch::TextId nEntitiesCountText_{};
     std::string sceneName_;
     unsigned int nEntities_ = 0;
+    Graphic::VertexArray graph_;
+    sf::Vector2f graphPos_;
+    std::vector<float> frameTimes_;  // ring buffer in milliseconds
+    std::size_t frameIndex_ = 0;
+    std::size_t nFrameTimes_ = 0;
 
 private:
     virtual void OnMessage(std::shared_ptr<Shared::Message> message) override;
+    virtual bool IsIsolated() const override { return false; }
+    std::vector<float> GetFrameTimes() const;
+    void BuildGraph(const std::vector<float>& frameTimes);
 };
 
 }  // namespace Scene
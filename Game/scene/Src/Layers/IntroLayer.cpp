@@ -8,6 +8,7 @@
 
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include "DrawList.h"
 #include "Folder.h"
 #include "Logging.h"
 #include "Message/MessageBus.h"
@@ -49,12 +50,13 @@ void IntroLayer::OnCreate()
     auto w2 = bounds2.width;
     sf::Vector2f pressTextPos(layerTexture_.getSize().x / 2.0f - w2 / 2, 400.0f);
     pressText_.setPosition(pressTextPos);
+    SetDirty();
 }
 
-void IntroLayer::Draw()
+void IntroLayer::Draw(Graphic::DrawList& drawList)
 {
-    layerTexture_.draw(introText_);
-    layerTexture_.draw(pressText_);
+    drawList.draw(introText_);
+    drawList.draw(pressText_);
 }
 
 void IntroLayer::Update(float deltaTime)
@@ -24,7 +24,7 @@ public:
     virtual std::string Name() const override { return "Intro"; }
     virtual LayerId GetId() const override { return LayerId::Intro; }
     virtual void Update(float deltaTime) override;
-    virtual void Draw() override;
+    virtual void Draw(Graphic::DrawList& drawList) override;
     virtual void EnableInput(bool enable) override {}
     virtual void OnLoad() override;
     virtual void OnCreate() override;
@@ -33,6 +33,9 @@ private:
     Graphic::Font font_;
     Graphic::Text introText_;
     Graphic::Text pressText_;
+
+private:
+    virtual bool IsRedrawnEveryFrame() const override { return false; }
 };
 
 }  // namespace Scene
@@ -8,6 +8,7 @@
 
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include "DrawList.h"
 #include "Level.h"
 #include "RectangleShape.h"
 #include "Transitions/BasicTransition.h"
@@ -30,24 +31,37 @@ LevelLayer::~LevelLayer() = default;
 
 void LevelLayer::OnLoad()
 {
-    level_->Load("levelCollider.tmx");
+    level_->LoadAsync("levelCollider.tmx");
+}
+
+bool LevelLayer::IsLoaded()
+{
+    return level_->IsLoaded();
+}
+
+float LevelLayer::GetLoadProgress() const
+{
+    return level_->GetLoadProgress();
 }
 
 void LevelLayer::OnCreate()
 {
     level_->Create();
+#ifdef _DEBUG
+    level_->EnableHotReload();
+#endif
 }
 
-void LevelLayer::Draw()
+void LevelLayer::Draw(Graphic::DrawList& drawList)
 {
-    auto view = level_->GetView();
-    layerTexture_.setView(view);
-    level_->Draw(layerTexture_);  // When drawing, the view must already have been set
+    drawList.SetView(level_->GetView());
+    level_->Draw(drawList);  // When drawing, the view must already have been set
+    drawList.ResetView();    // layers drawn after are in window coordinates
 }
 
-void LevelLayer::DrawTransition(const BasicTransition& transition)
+void LevelLayer::DrawTransition(Graphic::DrawList& drawList, const BasicTransition& transition)
 {
-    transition.DrawTo(layerTexture_);
+    transition.DrawTo(drawList);
 }
 
 void LevelLayer::Update(float deltaTime)
@@ -37,13 +37,19 @@ public:
     virtual std::string Name() const override { return "Level"; }
     virtual LayerId GetId() const override { return LayerId::Level; }
     virtual void Update(float deltaTime) override;
-    virtual void Draw() override;
+    virtual void Draw(Graphic::DrawList& drawList) override;
     virtual void EnableInput(bool enable) override {}
     virtual void EnterTransition(BasicTransition& transition) override;
-    virtual void DrawTransition(const BasicTransition& transition) override;
+    virtual void DrawTransition(Graphic::DrawList& drawList, const BasicTransition& transition) override;
     virtual void OnLoad() override;
+    virtual bool IsLoaded() override;
+    virtual float GetLoadProgress() const override;
     virtual void OnCreate() override;
 
+private:
+    // Covers the whole window and changes every frame, so it is drawn straight to the window
+    virtual bool IsIsolated() const override { return false; }
+
 private:
     Shared::MessageBus& messageBus_;
     std::unique_ptr<World::Level> level_ = nullptr;
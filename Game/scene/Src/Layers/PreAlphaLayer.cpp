@@ -8,6 +8,7 @@
 
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include "DrawList.h"
 #include "Folder.h"
 #include "Logging.h"
 #include "Message/MessageBus.h"
@@ -42,11 +43,12 @@ void PreAlphaLayer::OnCreate()
     auto w1 = bounds1.width;
     sf::Vector2f versionTextPos(layerTexture_.getSize().x / 2.0f - w1 / 2.0f, 0.0f);
     versionText_.setPosition(versionTextPos);
+    SetDirty();
 }
 
-void PreAlphaLayer::Draw()
+void PreAlphaLayer::Draw(Graphic::DrawList& drawList)
 {
-    layerTexture_.draw(versionText_);
+    drawList.draw(versionText_);
 }
 
 void PreAlphaLayer::Update(float deltaTime)
@@ -24,7 +24,7 @@ public:
     virtual std::string Name() const override { return "PreAlpha"; }
     virtual LayerId GetId() const override { return LayerId::PreAlpha; }
     virtual void Update(float deltaTime) override;
-    virtual void Draw() override;
+    virtual void Draw(Graphic::DrawList& drawList) override;
     virtual void EnableInput(bool enable) override {}
     virtual void OnLoad() override;
     virtual void OnCreate() override;
@@ -32,6 +32,9 @@ public:
 private:
     Graphic::Font font_;
     Graphic::Text versionText_;
+
+private:
+    virtual bool IsRedrawnEveryFrame() const override { return false; }
 };
 
 }  // namespace Scene
@@ -7,6 +7,7 @@
 #include "Manager.h"
 
 #include "Logging.h"
+#include "Profiler.h"
 #include "Scenes/IntroScene.h"
 #include "Scenes/TransitionScene.h"
 
@@ -14,7 +15,9 @@ namespace FA {
 
 namespace Scene {
 
-Manager::Manager(Shared::MessageBus& messageBus, Shared::TextureManager& textureManager)
+Manager::Manager(Shared::MessageBus& messageBus, Shared::TextureManager& textureManager,
+                 std::function<void()> beforeSwitchFn)
+    : beforeSwitchFn_(beforeSwitchFn)
 {
     currentScene_ = std::make_unique<IntroScene>(*this, messageBus, textureManager, layers_, data_);
     // LOG_INFO("Enter ", currentScene_->Name());
@@ -23,12 +26,14 @@ Manager::Manager(Shared::MessageBus& messageBus, Shared::TextureManager& texture
 
 Manager::~Manager()
 {
+    beforeSwitchFn_();
     // LOG_INFO("Exit ", currentScene_->Name());
     currentScene_->Exit();
 }
 
 void Manager::SetScene(std::unique_ptr<BasicScene> newScene)
 {
+    beforeSwitchFn_();
     // LOG_INFO("Exit ", currentScene_->Name());
     currentScene_->Exit();
     currentScene_ = std::move(newScene);
@@ -43,13 +48,15 @@ void Manager::SetTransitionScene(Shared::MessageBus& messageBus, Shared::Texture
         std::make_unique<TransitionScene>(*this, messageBus, textureManager, layers_, data_, std::move(transition)));
 }
 
-void Manager::DrawTo(Graphic::RenderTargetIf& renderTarget)
+void Manager::DrawTo(Graphic::DrawList& drawList)
 {
-    currentScene_->DrawTo(renderTarget);
+    PROFILE_SCOPE("Scene::DrawTo");
+    currentScene_->DrawTo(drawList);
 }
 
 void Manager::Update(float deltaTime)
 {
+    PROFILE_SCOPE("Scene::Update");
     currentScene_->Update(deltaTime);
 }
 
@@ -15,7 +15,7 @@ namespace FA {
 
 namespace Graphic {
 
-class RenderTargetIf;
+class DrawList;
 
 }  // namespace Graphic
 
@@ -35,12 +35,16 @@ public:
                Manager::Layers& layers, Manager::Data& data);
     virtual ~BasicScene();
 
-    virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) = 0;
+    virtual void DrawTo(Graphic::DrawList& drawList) = 0;
     virtual void Update(float deltaTime) = 0;
     virtual std::string Name() const = 0;
 
     virtual void Enter() {}
     virtual void Exit() {}
+    // Called while the transition into the scene runs, Enter is not called until IsLoaded is true
+    virtual void Load() {}
+    virtual bool IsLoaded() { return true; }
+    virtual float GetLoadProgress() const { return 1.0f; }
 
     bool IsRunning() const;
 
@@ -63,13 +63,11 @@ void IntroScene::Exit()
     }
 }
 
-void IntroScene::DrawTo(Graphic::RenderTargetIf& renderTarget)
+void IntroScene::DrawTo(Graphic::DrawList& drawList)
 {
     for (const auto& entry : layers_) {
         auto& layer = entry.second;
-        layer->Clear();
-        layer->Draw();
-        layer->DrawTo(renderTarget);
+        layer->DrawTo(drawList);
     }
 }
 
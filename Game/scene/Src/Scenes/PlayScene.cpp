@@ -6,6 +6,10 @@
 
 #include "PlayScene.h"
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 #include <SFML/Graphics/Rect.hpp>
 
 #include "IntroScene.h"
@@ -28,26 +32,58 @@ PlayScene::PlayScene(Manager& sceneManager, Shared::MessageBus& messageBus, Shar
 
 PlayScene::~PlayScene() = default;
 
-void PlayScene::Enter()
+void PlayScene::Load()
 {
     sf::IntRect rect(0, 0, Shared::Screen::width, Shared::Screen::height);
-    layers_.clear();
-    layers_[LayerId::Level] = std::make_unique<LevelLayer>(messageBus_, rect, textureManager_);
+    loadingLayers_[LayerId::Level] = std::make_unique<LevelLayer>(messageBus_, rect, textureManager_);
 #ifdef _DEBUG
-    layers_[LayerId::Helper] = std::make_unique<HelperLayer>(messageBus_, rect, Name());
+    loadingLayers_[LayerId::Helper] = std::make_unique<HelperLayer>(messageBus_, rect, Name());
 #endif
-    layers_[LayerId::PreAlpha] = std::make_unique<PreAlphaLayer>(messageBus_, rect);
+    loadingLayers_[LayerId::PreAlpha] = std::make_unique<PreAlphaLayer>(messageBus_, rect);
 
-    // subscribe layer message before entity is created (so layer can receive EntityInitializedMessage)
-    Subscribe({Shared::MessageType::CloseWindow, Shared::MessageType::KeyPressed, Shared::MessageType::GameOver});
-    for (const auto& entry : layers_) {
+    for (const auto& entry : loadingLayers_) {
         auto& layer = entry.second;
-        layer->SubscribeMessages();
+        layer->OnLoad();
+    }
+}
+
+bool PlayScene::IsLoaded()
+{
+    bool isLoaded = true;
+    for (const auto& entry : loadingLayers_) {
+        auto& layer = entry.second;
+        isLoaded = layer->IsLoaded() && isLoaded;
+    }
+
+    return isLoaded;
+}
+
+float PlayScene::GetLoadProgress() const
+{
+    float progress = 1.0f;
+    for (const auto& entry : loadingLayers_) {
+        auto& layer = entry.second;
+        progress = std::min(progress, layer->GetLoadProgress());
+    }
+
+    return progress;
+}
+
+void PlayScene::Enter()
+{
+    // only when not entered through a transition
+    if (loadingLayers_.empty()) Load();
+    while (!IsLoaded()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
+    layers_.swap(loadingLayers_);
+    loadingLayers_.clear();
 
+    // subscribe layer message before entity is created (so layer can receive EntityInitializedMessage)
+    Subscribe({Shared::MessageType::CloseWindow, Shared::MessageType::KeyPressed, Shared::MessageType::GameOver});
     for (const auto& entry : layers_) {
         auto& layer = entry.second;
-        layer->OnLoad();
+        layer->SubscribeMessages();
     }
 
     for (const auto& entry : layers_) {
@@ -65,13 +101,11 @@ void PlayScene::Exit()
     }
 }
 
-void PlayScene::DrawTo(Graphic::RenderTargetIf& renderTarget)
+void PlayScene::DrawTo(Graphic::DrawList& drawList)
 {
     for (const auto& entry : layers_) {
         auto& layer = entry.second;
-        layer->Clear();
-        layer->Draw();
-        layer->DrawTo(renderTarget);
+        layer->DrawTo(drawList);
     }
 }
 
@@ -19,12 +19,18 @@ public:
               Manager::Layers& layers, Manager::Data& data);
     virtual ~PlayScene();
 
-    virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) override;
+    virtual void DrawTo(Graphic::DrawList& drawList) override;
     virtual void Update(float deltaTime) override;
     virtual std::string Name() const override { return "PlayScene"; }
 
     virtual void Enter() override;
     virtual void Exit() override;
+    virtual void Load() override;
+    virtual bool IsLoaded() override;
+    virtual float GetLoadProgress() const override;
+
+private:
+    Manager::Layers loadingLayers_;  // the layers of the previous scene are drawn until Enter
 
 private:
     virtual void OnMessage(std::shared_ptr<Shared::Message> message) override;
@@ -6,8 +6,10 @@
 
 #include "TransitionScene.h"
 
+#include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Rect.hpp>
 
+#include "DrawList.h"
 #include "Layers/HelperLayer.h"
 #include "Screen.h"
 #include "Transitions/BasicTransition.h"
@@ -16,6 +18,12 @@ namespace FA {
 
 namespace Scene {
 
+namespace {
+
+constexpr float progressBarHeight = 4.0f;
+
+}  // namespace
+
 TransitionScene::TransitionScene(Manager& sceneManager, Shared::MessageBus& messageBus,
                                  Shared::TextureManager& textureManager, Manager::Layers& layers, Manager::Data& data,
                                  std::unique_ptr<BasicTransition> transition)
@@ -38,6 +46,11 @@ void TransitionScene::Enter()
         layer->EnterTransition(*transition_);
         layer->EnableInput(false);
     }
+
+    progressBar_.setPosition(0.0f, Shared::Screen::height_f - progressBarHeight);
+    progressBar_.setFillColor(sf::Color::White);
+    nextScene_ = transition_->CreateNextScene(messageBus_, textureManager_);
+    nextScene_->Load();
 }
 
 void TransitionScene::Exit()
@@ -48,26 +61,28 @@ void TransitionScene::Exit()
     }
 }
 
-void TransitionScene::DrawTo(Graphic::RenderTargetIf& renderTarget)
+void TransitionScene::DrawTo(Graphic::DrawList& drawList)
 {
     for (const auto& entry : layers_) {
         auto& layer = entry.second;
-        layer->Clear();
-        layer->Draw();
-        layer->DrawTransition(*transition_);
-        layer->DrawTo(renderTarget);
+        layer->DrawTo(drawList, *transition_);
     }
+
+    if (nextScene_->GetLoadProgress() < 1.0f) drawList.draw(progressBar_);
 }
 
 void TransitionScene::Update(float deltaTime)
 {
     transition_->Update(deltaTime);
 
-    if (transition_->IsFinished()) {
-        SwitchScene(transition_->CreateNextScene(messageBus_, textureManager_));
+    // Polled once the transition is finished, so the upload of the next scene happens behind a finished transition
+    if (transition_->IsFinished() && nextScene_->IsLoaded()) {
+        SwitchScene(std::move(nextScene_));
         return;
     }
 
+    progressBar_.setSize({Shared::Screen::width_f * nextScene_->GetLoadProgress(), progressBarHeight});
+
     for (const auto& entry : layers_) {
         auto& layer = entry.second;
         layer->Update(deltaTime);
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "BasicScene.h"
+#include "RectangleShape.h"
 
 namespace FA {
 
@@ -21,7 +22,7 @@ public:
                     Manager::Layers& layers, Manager::Data& Data, std::unique_ptr<BasicTransition> transition);
     virtual ~TransitionScene();
 
-    virtual void DrawTo(Graphic::RenderTargetIf& renderTarget) override;
+    virtual void DrawTo(Graphic::DrawList& drawList) override;
     virtual void Update(float deltaTime) override;
     virtual std::string Name() const override { return "TransitionScene"; }
 
@@ -30,6 +31,8 @@ public:
 
 private:
     std::unique_ptr<BasicTransition> transition_ = nullptr;
+    std::unique_ptr<BasicScene> nextScene_ = nullptr;  // loads while the transition runs
+    Graphic::RectangleShape progressBar_;
 };
 
 }  // namespace Scene
@@ -6,6 +6,8 @@
 
 #include "FadeTransition.h"
 
+#include <algorithm>
+
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/System/Vector2.hpp>
 
@@ -25,10 +27,10 @@ FadeTransition::~FadeTransition() = default;
 
 void FadeTransition::Enter(const Graphic::RenderTextureIf& renderTexture)
 {
-    sf::Vector2f position = renderTexture.mapPixelToCoords({0, 0});
+    // Transitions are drawn with the default view, the view of renderTexture is owned by the render thread
     sf::Vector2f size = static_cast<sf::Vector2f>(renderTexture.getSize());
     fadeRect_ = std::make_shared<Graphic::RectangleShape>(size);
-    fadeRect_->setPosition(position);
+    fadeRect_->setPosition(0.0f, 0.0f);
     fadeRect_->setFillColor(sf::Color(0, 0, 0, 0));
 }
 
@@ -41,7 +43,8 @@ void FadeTransition::Update(float deltaTime)
 {
     if (fadeRect_) {
         elapsedTime_ += deltaTime;
-        float currentAlpha = startAlpha_ + (endAlpha_ - startAlpha_) * (elapsedTime_ / duration_);
+        // the transition is kept after duration while the next scene loads
+        float currentAlpha = startAlpha_ + (endAlpha_ - startAlpha_) * std::min(elapsedTime_ / duration_, 1.0f);
         fadeRect_->setFillColor(sf::Color(0, 0, 0, static_cast<unsigned int>(currentAlpha)));
     }
 }
@@ -0,0 +1,48 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace FA {
+
+namespace Shared {
+
+/* Skyline bottom-left packer. Rectangles are placed at the lowest possible position along the
+ * skyline, leftmost on ties. Padding is reserved to the right of and below each rectangle.
+ */
+class AtlasPacker
+{
+public:
+    AtlasPacker(const sf::Vector2u &size, unsigned int padding = 0);
+
+    bool Insert(const sf::Vector2u &size, sf::Vector2u &position);
+    sf::Vector2u GetSize() const { return size_; }
+    unsigned int GetUsedHeight() const;
+
+private:
+    struct Segment
+    {
+        unsigned int x_{};
+        unsigned int y_{};
+        unsigned int width_{};
+    };
+
+    const sf::Vector2u size_;
+    const unsigned int padding_;
+    std::vector<Segment> skyline_;
+
+private:
+    bool Fit(std::size_t index, const sf::Vector2u &size, unsigned int &y) const;
+    void AddSegment(std::size_t index, const Segment &segment);
+};
+
+}  // namespace Shared
+
+}  // namespace FA
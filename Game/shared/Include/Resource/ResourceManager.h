@@ -6,21 +6,82 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
+#include <SFML/System/Vector2.hpp>
+
+#include "ImageIf.h"
 #include "Logging.h"
+#include "Profiler.h"
 #include "ResourceId.h"
+#include "ResourceTraits.h"
 
 namespace FA {
 
 namespace Shared {
 
-template <class R>
+template <class R, class Traits = ResourceTraits<R>>
 class ResourceManager
 {
+public:
+    // Keeps a resource from being unloaded or evicted. Must not outlive the manager.
+    class Handle
+    {
+    public:
+        Handle() = default;
+        Handle(const Handle& other)
+            : manager_(other.manager_)
+            , id_(other.id_)
+        {
+            if (manager_ != nullptr) manager_->AddRef(id_);
+        }
+        Handle(Handle&& other) noexcept
+            : manager_(other.manager_)
+            , id_(other.id_)
+        {
+            other.manager_ = nullptr;
+            other.id_ = InvalidResourceId;
+        }
+        ~Handle() { Reset(); }
+
+        // by value, so both copy and move assign swap; noexcept lets vectors of handles move on growth
+        Handle& operator=(Handle other) noexcept
+        {
+            std::swap(manager_, other.manager_);
+            std::swap(id_, other.id_);
+            return *this;
+        }
+
+        void Reset()
+        {
+            if (manager_ != nullptr) manager_->Release(id_);
+            manager_ = nullptr;
+            id_ = InvalidResourceId;
+        }
+
+        ResourceId GetId() const { return id_; }
+        const R* Get() const { return manager_ != nullptr ? manager_->Get(id_) : nullptr; }
+
+    private:
+        friend class ResourceManager;
+
+        ResourceManager* manager_ = nullptr;
+        ResourceId id_ = InvalidResourceId;
+
+    private:
+        Handle(ResourceManager& manager, ResourceId id)
+            : manager_(&manager)
+            , id_(id)
+        {
+            manager_->AddRef(id_);
+        }
+    };
+
 public:
     ResourceManager(std::function<std::unique_ptr<R>()> createFn)
         : createFn_(createFn)
@@ -28,43 +89,188 @@ public:
 
     ResourceId Load(const std::string& path)
     {
-        auto it = paths_.find(path);
-        if (it != paths_.end()) {
+        PROFILE_SCOPE("ResourceManager::Load");
+        // the path is hashed once, by emplace
+        auto inserted = paths_.emplace(path, id_);
+        if (!inserted.second) {
             LOG_WARN("%s is already loaded", DUMP(path));
-            return paths_.at(path);
+            return inserted.first->second;
         }
 
         auto resource = createFn_();
 
         if (resource->loadFromFile(path)) {
-            paths_[path] = id_;
-            resources_.emplace(id_, std::move(resource));
+            Insert(id_, path, std::move(resource));
             auto n = resources_.size();
             LOG_INFO("Loaded %u resource(s)", n);
+            Evict();
             return id_++;
         }
         else {
+            paths_.erase(inserted.first);
             LOG_ERROR("Could not load %s", DUMP(path));
             return InvalidResourceId;
         }
     }
 
+    // For resources created in memory, e.g. a texture atlas. The name is used as path.
+    ResourceId Add(const std::string& name, std::unique_ptr<R> resource)
+    {
+        auto inserted = paths_.emplace(name, id_);
+        if (!inserted.second) {
+            LOG_WARN("%s is already added", DUMP(name));
+            return inserted.first->second;
+        }
+
+        Insert(id_, name, std::move(resource));
+        auto n = resources_.size();
+        LOG_INFO("Added %u resource(s)", n);
+        Evict();
+        return id_++;
+    }
+
     const R* Get(ResourceId id) const
     {
         auto it = resources_.find(id);
 
-        if (it != resources_.end()) return it->second.get();
+        if (it != resources_.end()) {
+            it->second.lastUse_ = ++useCount_;
+            return it->second.resource_.get();
+        }
 
-        LOG_ERROR("Could not get %s", DUMP(id));
+        return NotFound(id);
+    }
 
-        return nullptr;
+    /* Checks that image fits into the resource at position, e.g. a sheet that changed on disk into its atlas
+     * page, and hands the resource to writeFn. The write can be deferred to the thread that draws with the
+     * resource. The resource is changed in place, so pointers to it stay valid.
+     */
+    bool Update(ResourceId id, const Graphic::ImageIf& image, const sf::Vector2u& position,
+                const std::function<void(R&)>& writeFn)
+    {
+        PROFILE_SCOPE("ResourceManager::Update");
+        if (Get(id) == nullptr) return false;
+
+        auto& entry = resources_.at(id);
+        auto size = entry.resource_->getSize();
+        auto imageSize = image.getSize();
+        if (position.x + imageSize.x > size.x || position.y + imageSize.y > size.y) {
+            LOG_ERROR("Could not update %s, image is outside", DUMP(entry.path_));
+            return false;
+        }
+
+        writeFn(*entry.resource_);
+        return true;
+    }
+
+    Handle Acquire(ResourceId id)
+    {
+        if (Get(id) == nullptr) return {};
+
+        return Handle(*this, id);
+    }
+
+    // Resources that are held by a handle are kept
+    bool Unload(ResourceId id)
+    {
+        auto it = resources_.find(id);
+        if (it == resources_.end()) {
+            LOG_ERROR("Could not unload %s", DUMP(id));
+            return false;
+        }
+        if (it->second.refCount_ > 0) {
+            LOG_WARN("%s is still referenced", DUMP(it->second.path_));
+            return false;
+        }
+
+        Remove(it);
+        return true;
     }
 
+    /* When more bytes than the budget are held, resources whose handles have all been released are evicted,
+     * least recently got first. Evicted ids are invalid. Resources that were never acquired are kept, since
+     * pointers from Get may still be in use. 0 means no budget.
+     */
+    void SetBudget(std::size_t bytes)
+    {
+        budget_ = bytes;
+        Evict();
+    }
+
+    std::size_t GetBytesHeld() const { return bytesHeld_; }
+
 private:
+    struct Entry
+    {
+        std::unique_ptr<R> resource_;
+        std::string path_;
+        std::size_t bytes_{};
+        unsigned int refCount_{};
+        bool isReleased_{false};
+        mutable std::uint64_t lastUse_{};
+    };
+
     ResourceId id_{0};
-    std::unordered_map<ResourceId, std::unique_ptr<R>> resources_;
+    std::unordered_map<ResourceId, Entry> resources_;
     std::function<std::unique_ptr<R>()> createFn_;
     std::unordered_map<std::string, ResourceId> paths_;
+    // Get only stamps the use, for eviction
+    mutable std::uint64_t useCount_{0};
+    std::size_t bytesHeld_{0};
+    std::size_t budget_{0};
+
+private:
+    // Out of line from Get, so formatting the error does not weigh on the lookup
+    const R* NotFound(ResourceId id) const
+    {
+        LOG_ERROR("Could not get %s", DUMP(id));
+        return nullptr;
+    }
+
+    void Insert(ResourceId id, const std::string& path, std::unique_ptr<R> resource)
+    {
+        Entry entry;
+        entry.bytes_ = Traits::GetSizeInBytes(*resource);
+        entry.resource_ = std::move(resource);
+        entry.path_ = path;
+        entry.lastUse_ = ++useCount_;
+        bytesHeld_ += entry.bytes_;
+        resources_.emplace(id, std::move(entry));
+    }
+
+    void Remove(typename std::unordered_map<ResourceId, Entry>::iterator it)
+    {
+        auto path = it->second.path_;
+        bytesHeld_ -= it->second.bytes_;
+        paths_.erase(path);
+        resources_.erase(it);
+        LOG_INFO("Unloaded %s, %zu %s bytes held", DUMP(path), bytesHeld_, Traits::TypeName());
+    }
+
+    void Evict()
+    {
+        while (budget_ > 0 && bytesHeld_ > budget_) {
+            auto lru = resources_.end();
+            for (auto it = resources_.begin(); it != resources_.end(); ++it) {
+                if (!it->second.isReleased_ || it->second.refCount_ > 0) continue;
+                if (lru == resources_.end() || it->second.lastUse_ < lru->second.lastUse_) lru = it;
+            }
+            if (lru == resources_.end()) return;  // all that is left is held or never acquired
+
+            Remove(lru);
+        }
+    }
+
+    void AddRef(ResourceId id) { resources_.at(id).refCount_++; }
+
+    void Release(ResourceId id)
+    {
+        auto it = resources_.find(id);
+        if (it != resources_.end() && --it->second.refCount_ == 0) {
+            it->second.isReleased_ = true;
+            Evict();
+        }
+    }
 };
 
 }  // namespace Shared
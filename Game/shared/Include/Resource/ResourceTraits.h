@@ -0,0 +1,24 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace FA {
+
+namespace Shared {
+
+template <class R>
+struct ResourceTraits
+{
+    static const char* TypeName() { return "resource"; }
+    static std::size_t GetSizeInBytes(const R& resource) { return 0; }
+};
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -10,6 +10,7 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include "InternedString.h"
 #include "SfmlPrint.h"
 
 namespace FA {
@@ -18,7 +19,7 @@ namespace Shared {
 
 struct SheetItem
 {
-    std::string id_;
+    Util::InternedString id_;
     sf::Vector2u position_{};
 };
 
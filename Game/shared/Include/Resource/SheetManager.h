@@ -10,6 +10,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "InternedString.h"
 #include "SpriteSheetIf.h"
 
 namespace FA {
@@ -23,12 +24,11 @@ class SheetManager
 public:
     void AddSheet(const std::string &name, std::unique_ptr<SpriteSheetIf> sheet);
     TextureRect GetTextureRect(const SheetItem &item) const;
+    // For many items of one sheet, resolve the sheet once and use SpriteSheetIf::At
+    const SpriteSheetIf *GetSheet(const Util::InternedString &sheetId) const;
 
 private:
-    std::unordered_map<std::string, std::unique_ptr<SpriteSheetIf>> sheetMap_;
-
-private:
-    SpriteSheetIf *GetSheet(const std::string &sheetId) const;
+    std::unordered_map<Util::InternedString, std::unique_ptr<SpriteSheetIf>> sheetMap_;
 };
 
 }  // namespace Shared
@@ -20,7 +20,9 @@ class SpriteSheet : public SpriteSheetIf
 {
 public:
     SpriteSheet() = default;
-    SpriteSheet(ResourceId textureId, const sf::Vector2u& textureSize, const sf::Vector2u& rectCount);
+    // offset is where the sheet starts within the texture, non-zero when the sheet is part of an atlas
+    SpriteSheet(ResourceId textureId, const sf::Vector2u& textureSize, const sf::Vector2u& rectCount,
+                const sf::Vector2u& offset = {});
 
     virtual TextureRect At(const sf::Vector2u& uvCoord) const override;
 
@@ -30,6 +32,7 @@ private:
     sf::Vector2u rectCount_;
     bool isValid_ = false;
     sf::Vector2u rectSize_;
+    sf::Vector2u offset_;
 };
 
 }  // namespace Shared
@@ -0,0 +1,92 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+#include "ImageIf.h"
+#include "TextureManager.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class RenderTargetIf;
+
+}  // namespace Graphic
+
+namespace Shared {
+
+class SheetManager;
+
+/* Collects sprite sheet images and packs them into as few textures as possible, so that sprites
+ * from different sheets can be drawn in one batch. Sheets are registered in the sheet manager
+ * with atlas relative texture rects once Build is called. Pack and Upload are the two halves of
+ * Build, so that packed pages can be stored in a cooked package and uploaded later.
+ */
+class TextureAtlas
+{
+public:
+    static constexpr unsigned int defaultPageSize = 2048;
+
+    struct Sheet
+    {
+        std::string name_;
+        std::size_t page_{};
+        sf::Vector2u position_;
+        sf::Vector2u size_;
+        sf::Vector2u rectCount_;
+    };
+
+    struct Packed
+    {
+        std::vector<Sheet> sheets_;
+        std::vector<std::unique_ptr<Graphic::ImageIf>> pages_;
+    };
+
+public:
+    TextureAtlas(TextureManager &textureManager, SheetManager &sheetManager,
+                 unsigned int pageSize = defaultPageSize);
+    ~TextureAtlas();
+
+    void Add(const std::string &name, const std::string &path, const sf::Vector2u &rectCount);
+    void Build();
+    Packed Pack();
+    void Upload(const Packed &packed);
+    /* Decodes path again and writes it over the uploaded sheet, in place, when renderTarget is drawn.
+     * The sheet must keep its size.
+     */
+    bool Reload(const std::string &name, const std::string &path, Graphic::RenderTargetIf &renderTarget);
+
+private:
+    struct Entry
+    {
+        std::string name_;
+        std::string path_;
+        sf::Vector2u rectCount_;
+        std::unique_ptr<Graphic::ImageIf> image_;
+        std::size_t page_{};
+        sf::Vector2u position_;
+    };
+
+    TextureManager &textureManager_;
+    SheetManager &sheetManager_;
+    const unsigned int pageSize_;
+    std::vector<Entry> entries_;
+    std::vector<TextureManager::Handle> pages_;  // uploaded pages are kept as long as the atlas
+    std::unordered_map<std::string, std::pair<Sheet, ResourceId>> sheets_;  // uploaded sheets and their page
+};
+
+}  // namespace Shared
+
+}  // namespace FA
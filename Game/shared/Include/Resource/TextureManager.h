@@ -8,12 +8,26 @@
 
 #include "ResourceManager.h"
 
+#include <SFML/System/Vector2.hpp>
+
+#include "ResourceTraits.h"
 #include "Texture.h"
 
 namespace FA {
 
 namespace Shared {
 
+template <>
+struct ResourceTraits<Graphic::Texture>
+{
+    static const char* TypeName() { return "texture"; }
+    static std::size_t GetSizeInBytes(const Graphic::Texture& texture)
+    {
+        auto size = texture.getSize();
+        return static_cast<std::size_t>(size.x) * size.y * 4;  // RGBA
+    }
+};
+
 using TextureManager = ResourceManager<Graphic::Texture>;
 
 }  // namespace Shared
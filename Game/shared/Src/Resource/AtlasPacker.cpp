@@ -0,0 +1,109 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "Resource/AtlasPacker.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace FA {
+
+namespace Shared {
+
+AtlasPacker::AtlasPacker(const sf::Vector2u &size, unsigned int padding)
+    : size_(size)
+    , padding_(padding)
+{
+    skyline_.push_back({0, 0, size_.x});
+}
+
+bool AtlasPacker::Insert(const sf::Vector2u &size, sf::Vector2u &position)
+{
+    if (size.x == 0 || size.y == 0) return false;
+
+    auto bestIndex = skyline_.size();
+    auto bestY = std::numeric_limits<unsigned int>::max();
+    for (std::size_t i = 0; i < skyline_.size(); i++) {
+        unsigned int y = 0;
+        if (Fit(i, size, y) && y < bestY) {
+            bestIndex = i;
+            bestY = y;
+        }
+    }
+    if (bestIndex == skyline_.size()) return false;
+
+    // padding is clipped at the edges, a rectangle may touch the right or bottom edge
+    auto x = skyline_[bestIndex].x_;
+    auto width = std::min(size.x + padding_, size_.x - x);
+    auto top = std::min(bestY + size.y + padding_, size_.y);
+    position = {x, bestY};
+    AddSegment(bestIndex, {x, top, width});
+
+    return true;
+}
+
+unsigned int AtlasPacker::GetUsedHeight() const
+{
+    unsigned int height = 0;
+    for (const auto &segment : skyline_) {
+        height = std::max(height, segment.y_);
+    }
+
+    return std::min(height, size_.y);
+}
+
+bool AtlasPacker::Fit(std::size_t index, const sf::Vector2u &size, unsigned int &y) const
+{
+    auto x = skyline_[index].x_;
+    if (x + size.x > size_.x) return false;
+
+    // the padding must rest on the skyline too, else a lower segment could be created under existing content
+    y = 0;
+    unsigned int remaining = std::min(size.x + padding_, size_.x - x);
+    for (auto i = index; remaining > 0; i++) {
+        y = std::max(y, skyline_[i].y_);
+        if (y + size.y > size_.y) return false;
+        remaining -= std::min(remaining, skyline_[i].width_);
+    }
+
+    return true;
+}
+
+void AtlasPacker::AddSegment(std::size_t index, const Segment &segment)
+{
+    skyline_.insert(skyline_.begin() + index, segment);
+
+    // shrink or remove the segments now covered by the new one
+    auto right = segment.x_ + segment.width_;
+    auto i = index + 1;
+    while (i < skyline_.size() && skyline_[i].x_ < right) {
+        auto &next = skyline_[i];
+        auto nextRight = next.x_ + next.width_;
+        if (nextRight <= right) {
+            skyline_.erase(skyline_.begin() + i);
+        }
+        else {
+            next.width_ = nextRight - right;
+            next.x_ = right;
+            break;
+        }
+    }
+
+    // merge neighbours at the same height
+    for (std::size_t j = 0; j + 1 < skyline_.size();) {
+        if (skyline_[j].y_ == skyline_[j + 1].y_) {
+            skyline_[j].width_ += skyline_[j + 1].width_;
+            skyline_.erase(skyline_.begin() + j + 1);
+        }
+        else {
+            j++;
+        }
+    }
+}
+
+}  // namespace Shared
+
+}  // namespace FA
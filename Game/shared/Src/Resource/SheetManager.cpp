@@ -31,12 +31,12 @@ TextureRect SheetManager::GetTextureRect(const SheetItem& item) const
     return {};
 }
 
-SpriteSheetIf* SheetManager::GetSheet(const std::string& sheetId) const
+const SpriteSheetIf* SheetManager::GetSheet(const Util::InternedString& sheetId) const
 {
     auto it = sheetMap_.find(sheetId);
 
     if (it != sheetMap_.end()) {
-        return sheetMap_.at(sheetId).get();
+        return it->second.get();
     }
     else {
         LOG_ERROR("%s not found", DUMP(sheetId));
@@ -14,11 +14,13 @@ namespace FA {
 
 namespace Shared {
 
-SpriteSheet::SpriteSheet(ResourceId textureId, const sf::Vector2u& textureSize, const sf::Vector2u& rectCount)
+SpriteSheet::SpriteSheet(ResourceId textureId, const sf::Vector2u& textureSize, const sf::Vector2u& rectCount,
+                         const sf::Vector2u& offset)
     : textureId_(textureId)
     , textureSize_(textureSize)
     , rectCount_(rectCount)
     , isValid_(true)
+    , offset_(offset)
 {
     if (rectCount_.x == 0 || rectCount_.y == 0 || textureSize_.x == 0 || textureSize_.y == 0) {
         isValid_ = false;
@@ -39,8 +41,8 @@ TextureRect SpriteSheet::At(const sf::Vector2u& uvCoord) const
             return {};
         }
 
-        int left = static_cast<int>(uvCoord.x * rectSize_.x);
-        int top = static_cast<int>(uvCoord.y * rectSize_.y);
+        int left = static_cast<int>(offset_.x + uvCoord.x * rectSize_.x);
+        int top = static_cast<int>(offset_.y + uvCoord.y * rectSize_.y);
         int width = static_cast<int>(rectSize_.x);
         int height = static_cast<int>(rectSize_.y);
         return TextureRect(textureId_, {left, top, width, height});
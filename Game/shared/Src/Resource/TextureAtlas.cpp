@@ -0,0 +1,181 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "Resource/TextureAtlas.h"
+
+#include <algorithm>
+#include <future>
+
+#include "Image.h"
+#include "Logging.h"
+#include "Profiler.h"
+#include "RenderTargetIf.h"
+#include "Resource/AtlasPacker.h"
+#include "Resource/SheetManager.h"
+#include "Resource/SpriteSheet.h"
+#include "Texture.h"
+#include "TextureUpdate.h"
+#include "ThreadPool.h"
+
+namespace FA {
+
+namespace Shared {
+
+namespace {
+
+constexpr unsigned int padding = 1;
+
+}  // namespace
+
+constexpr unsigned int TextureAtlas::defaultPageSize;
+
+TextureAtlas::TextureAtlas(TextureManager &textureManager, SheetManager &sheetManager, unsigned int pageSize)
+    : textureManager_(textureManager)
+    , sheetManager_(sheetManager)
+    , pageSize_(pageSize)
+{}
+
+TextureAtlas::~TextureAtlas() = default;
+
+void TextureAtlas::Add(const std::string &name, const std::string &path, const sf::Vector2u &rectCount)
+{
+    Entry entry;
+    entry.name_ = name;
+    entry.path_ = path;
+    entry.rectCount_ = rectCount;
+    entries_.push_back(std::move(entry));
+}
+
+void TextureAtlas::Build()
+{
+    PROFILE_SCOPE("TextureAtlas::Build");
+    Upload(Pack());
+}
+
+TextureAtlas::Packed TextureAtlas::Pack()
+{
+    // decoding is most of the load time, all images are decoded in parallel
+    std::vector<std::future<std::unique_ptr<Graphic::ImageIf>>> images;
+    for (const auto &entry : entries_) {
+        auto path = entry.path_;
+        images.push_back(Util::ThreadPool::Instance().Submit([path]() -> std::unique_ptr<Graphic::ImageIf> {
+            auto image = std::make_unique<Graphic::Image>();
+            if (!image->loadFromFile(path)) return nullptr;
+            return std::move(image);
+        }));
+    }
+
+    std::vector<std::size_t> order;
+    {
+        PROFILE_SCOPE("TextureAtlas::Decode");
+        for (std::size_t i = 0; i < entries_.size(); i++) {
+            auto image = images[i].get();
+            if (!image) {
+                LOG_ERROR("Could not load %s", DUMP(entries_[i].path_));
+                continue;
+            }
+            entries_[i].image_ = std::move(image);
+            order.push_back(i);
+        }
+    }
+
+    // tallest first gives a flatter skyline
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs) {
+        return entries_[lhs].image_->getSize().y > entries_[rhs].image_->getSize().y;
+    });
+
+    std::vector<std::unique_ptr<AtlasPacker>> packers;
+    for (auto i : order) {
+        auto &entry = entries_[i];
+        auto size = entry.image_->getSize();
+        auto it = std::find_if(packers.begin(), packers.end(), [&entry, &size](std::unique_ptr<AtlasPacker> &packer) {
+            return packer->Insert(size, entry.position_);
+        });
+        if (it == packers.end()) {
+            // an image larger than a page gets a page of its own
+            sf::Vector2u pageSize(std::max(pageSize_, size.x), std::max(pageSize_, size.y));
+            packers.push_back(std::make_unique<AtlasPacker>(pageSize, padding));
+            packers.back()->Insert(size, entry.position_);
+            it = std::prev(packers.end());
+        }
+        entry.page_ = std::distance(packers.begin(), it);
+    }
+
+    Packed packed;
+    for (const auto &packer : packers) {
+        auto page = std::make_unique<Graphic::Image>();
+        page->create(packer->GetSize().x, packer->GetUsedHeight());
+        packed.pages_.push_back(std::move(page));
+    }
+    for (auto i : order) {
+        const auto &entry = entries_[i];
+        packed.pages_[entry.page_]->copy(*entry.image_, entry.position_.x, entry.position_.y);
+        auto size = entry.image_->getSize();
+        packed.sheets_.push_back({entry.name_, entry.page_, entry.position_, size, entry.rectCount_});
+    }
+
+    LOG_INFO("Packed %u image(s) into %u page(s)", order.size(), packed.pages_.size());
+    entries_.clear();
+
+    return packed;
+}
+
+void TextureAtlas::Upload(const Packed &packed)
+{
+    for (std::size_t p = 0; p < packed.pages_.size(); p++) {
+        std::string pageName = "atlas";
+        for (const auto &sheet : packed.sheets_) {
+            if (sheet.page_ == p) pageName += "|" + sheet.name_;
+        }
+
+        auto texture = std::make_unique<Graphic::Texture>();
+        if (!texture->loadFromImage(*packed.pages_[p])) {
+            LOG_ERROR("Could not create texture for %s", DUMP(pageName));
+            continue;
+        }
+        auto id = textureManager_.Add(pageName, std::move(texture));
+        pages_.push_back(textureManager_.Acquire(id));
+        for (const auto &sheet : packed.sheets_) {
+            if (sheet.page_ != p) continue;
+            auto spriteSheet = std::make_unique<SpriteSheet>(id, sheet.size_, sheet.rectCount_, sheet.position_);
+            sheetManager_.AddSheet(sheet.name_, std::move(spriteSheet));
+            sheets_[sheet.name_] = std::make_pair(sheet, id);
+        }
+    }
+}
+
+bool TextureAtlas::Reload(const std::string &name, const std::string &path, Graphic::RenderTargetIf &renderTarget)
+{
+    PROFILE_SCOPE("TextureAtlas::Reload");
+    auto it = sheets_.find(name);
+    if (it == sheets_.end()) {
+        LOG_ERROR("%s is not uploaded", DUMP(name));
+        return false;
+    }
+
+    const auto &sheet = it->second.first;
+    Graphic::Image image;
+    if (!image.loadFromFile(path)) {
+        LOG_ERROR("Could not load %s", DUMP(path));
+        return false;
+    }
+    // a sheet of another size would overlap its neighbours, and its texture rects would change
+    if (image.getSize() != sheet.size_) {
+        LOG_WARN("%s changed size, load the level again to see it", DUMP(name));
+        return false;
+    }
+    auto write = [&renderTarget, &image, &sheet](Graphic::Texture &page) {
+        renderTarget.draw(Graphic::TextureUpdate(page, image, sheet.position_));
+    };
+    if (!textureManager_.Update(it->second.second, image, sheet.position_, write)) return false;
+
+    LOG_INFO("Reloaded %s", DUMP(name));
+    return true;
+}
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -0,0 +1,107 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <utility>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Resource/AtlasPacker.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Shared {
+
+class AtlasPackerTest : public Test
+{
+protected:
+    static bool Overlaps(const sf::Vector2u &pos1, const sf::Vector2u &size1, const sf::Vector2u &pos2,
+                         const sf::Vector2u &size2)
+    {
+        sf::IntRect r1(static_cast<sf::Vector2i>(pos1), static_cast<sf::Vector2i>(size1));
+        sf::IntRect r2(static_cast<sf::Vector2i>(pos2), static_cast<sf::Vector2i>(size2));
+        return r1.intersects(r2);
+    }
+};
+
+TEST_F(AtlasPackerTest, InsertIntoEmptyAtlasShouldPlaceAtOrigin)
+{
+    AtlasPacker packer({100, 100});
+    sf::Vector2u position{1, 1};
+
+    EXPECT_TRUE(packer.Insert({10, 20}, position));
+    EXPECT_THAT(position, Eq(sf::Vector2u(0, 0)));
+    EXPECT_THAT(packer.GetUsedHeight(), Eq(20u));
+}
+
+TEST_F(AtlasPackerTest, InsertShouldPlaceNextToPreviousWithPadding)
+{
+    AtlasPacker packer({100, 100}, 2);
+    sf::Vector2u position1, position2;
+
+    EXPECT_TRUE(packer.Insert({10, 20}, position1));
+    EXPECT_TRUE(packer.Insert({10, 20}, position2));
+    EXPECT_THAT(position2, Eq(sf::Vector2u(12, 0)));
+}
+
+TEST_F(AtlasPackerTest, InsertShouldPlaceAtLowestSkyline)
+{
+    AtlasPacker packer({30, 100});
+    sf::Vector2u position1, position2, position3;
+
+    EXPECT_TRUE(packer.Insert({10, 50}, position1));
+    EXPECT_TRUE(packer.Insert({20, 10}, position2));
+    EXPECT_TRUE(packer.Insert({20, 10}, position3));
+    EXPECT_THAT(position2, Eq(sf::Vector2u(10, 0)));
+    EXPECT_THAT(position3, Eq(sf::Vector2u(10, 10)));
+}
+
+TEST_F(AtlasPackerTest, InsertShouldFillAtlasWithoutOverlap)
+{
+    AtlasPacker packer({64, 64}, 1);
+    std::vector<std::pair<sf::Vector2u, sf::Vector2u>> placed;
+    sf::Vector2u size{15, 15};
+    sf::Vector2u position;
+
+    while (packer.Insert(size, position)) {
+        EXPECT_LE(position.x + size.x, 64u);
+        EXPECT_LE(position.y + size.y, 64u);
+        for (const auto &p : placed) {
+            EXPECT_FALSE(Overlaps(p.first, p.second, position, size));
+        }
+        placed.push_back({position, size});
+    }
+
+    EXPECT_THAT(placed.size(), Eq(16u));
+}
+
+TEST_F(AtlasPackerTest, InsertTooLargeShouldFail)
+{
+    AtlasPacker packer({100, 100});
+    sf::Vector2u position;
+
+    EXPECT_FALSE(packer.Insert({101, 10}, position));
+    EXPECT_FALSE(packer.Insert({10, 101}, position));
+    EXPECT_TRUE(packer.Insert({100, 100}, position));
+    EXPECT_FALSE(packer.Insert({1, 1}, position));
+}
+
+TEST_F(AtlasPackerTest, InsertEmptyShouldFail)
+{
+    AtlasPacker packer({100, 100});
+    sf::Vector2u position;
+
+    EXPECT_FALSE(packer.Insert({0, 10}, position));
+}
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -5,12 +5,15 @@
  */
 
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <SFML/Graphics/Rect.hpp>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "ImageMock.h"
 #include "Mock/LoggerMock.h"
 #include "Resource/ResourceManager.h"
 #include "TextureMock.h"
@@ -80,6 +83,27 @@ TEST_F(ResourceManagerTest, LoadResourceShouldFail)
     EXPECT_THAT(result, IsNull());
 }
 
+TEST_F(ResourceManagerTest, AddResourceShouldSucceed)
+{
+    auto expectedPtr = resourceMock_.get();
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry("Added 1 resource(s)"));
+
+    auto id = resourceManager_.Add("atlas", std::move(resourceMock_));
+    EXPECT_EQ(id, 0);
+    auto result = resourceManager_.Get(id);
+    EXPECT_EQ(result, expectedPtr);
+}
+
+TEST_F(ResourceManagerTest, AddDuplicatedResourceShouldWarn)
+{
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry("Added 1 resource(s)"));
+    auto id1 = resourceManager_.Add("atlas", std::move(resourceMock_));
+
+    EXPECT_CALL(loggerMock_, MakeWarnLogEntry(ContainsRegex("atlas.*is already added")));
+    auto id2 = resourceManager_.Add("atlas", std::make_unique<StrictMock<SomeResourceMock>>());
+    EXPECT_EQ(id2, id1);
+}
+
 TEST_F(ResourceManagerTest, GetResourceShouldReturnNull)
 {
     EXPECT_CALL(loggerMock_, MakeErrorLogEntry(ContainsRegex("Could not get.*123")));
@@ -87,6 +111,179 @@ TEST_F(ResourceManagerTest, GetResourceShouldReturnNull)
     EXPECT_THAT(result, IsNull());
 }
 
+TEST_F(ResourceManagerTest, UpdateResourceShouldHandResourceToWrite)
+{
+    auto expectedPtr = resourceMock_.get();
+    StrictMock<Graphic::ImageMock> image;
+    StrictMock<MockFunction<void(SomeResourceMock&)>> writeFn;
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry("Added 1 resource(s)"));
+    auto id = resourceManager_.Add("atlas", std::move(resourceMock_));
+
+    EXPECT_CALL(*expectedPtr, getSize()).WillOnce(Return(sf::Vector2u(64, 64)));
+    EXPECT_CALL(image, getSize()).WillOnce(Return(sf::Vector2u(16, 16)));
+    EXPECT_CALL(writeFn, Call(Ref(*expectedPtr)));
+    EXPECT_TRUE(resourceManager_.Update(id, image, {48, 32}, writeFn.AsStdFunction()));
+    EXPECT_EQ(resourceManager_.Get(id), expectedPtr);
+}
+
+TEST_F(ResourceManagerTest, UpdateResourceWithImageOutsideShouldFail)
+{
+    auto expectedPtr = resourceMock_.get();
+    StrictMock<Graphic::ImageMock> image;
+    StrictMock<MockFunction<void(SomeResourceMock&)>> writeFn;
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry("Added 1 resource(s)"));
+    auto id = resourceManager_.Add("atlas", std::move(resourceMock_));
+
+    EXPECT_CALL(*expectedPtr, getSize()).WillOnce(Return(sf::Vector2u(64, 64)));
+    EXPECT_CALL(image, getSize()).WillOnce(Return(sf::Vector2u(16, 16)));
+    EXPECT_CALL(loggerMock_, MakeErrorLogEntry(ContainsRegex("Could not update.*atlas.*outside")));
+    EXPECT_FALSE(resourceManager_.Update(id, image, {56, 32}, writeFn.AsStdFunction()));
+}
+
+class ResourceManagerBudgetTest : public Test
+{
+protected:
+    struct SomeResourceTraits
+    {
+        static const char* TypeName() { return "some"; }
+        static std::size_t GetSizeInBytes(const Graphic::TextureMock& resource) { return 100; }
+    };
+
+    using SomeResourceMock = Graphic::TextureMock;
+    using SomeResourceManager = ResourceManager<SomeResourceMock, SomeResourceTraits>;
+
+    ResourceManagerBudgetTest()
+        : resourceManager_(createFn_.AsStdFunction())
+    {}
+
+    ResourceId Add(const std::string& name)
+    {
+        EXPECT_CALL(loggerMock_, MakeInfoLogEntry(StartsWith("Added")));
+        return resourceManager_.Add(name, std::make_unique<StrictMock<SomeResourceMock>>());
+    }
+
+    StrictMock<LoggerMock> loggerMock_;
+    MockFunction<std::unique_ptr<SomeResourceMock>()> createFn_;
+    SomeResourceManager resourceManager_;
+};
+
+TEST_F(ResourceManagerBudgetTest, AddResourceShouldCountBytes)
+{
+    Add("atlas1");
+    Add("atlas2");
+
+    EXPECT_EQ(resourceManager_.GetBytesHeld(), 200u);
+}
+
+TEST_F(ResourceManagerBudgetTest, UnloadResourceShouldSucceed)
+{
+    auto id = Add("atlas");
+
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry(ContainsRegex("Unloaded.*atlas.*0 some bytes held")));
+    EXPECT_TRUE(resourceManager_.Unload(id));
+    EXPECT_EQ(resourceManager_.GetBytesHeld(), 0u);
+    EXPECT_CALL(loggerMock_, MakeErrorLogEntry(ContainsRegex("Could not get")));
+    EXPECT_THAT(resourceManager_.Get(id), IsNull());
+}
+
+TEST_F(ResourceManagerBudgetTest, UnloadHeldResourceShouldWarn)
+{
+    auto id = Add("atlas");
+    auto handle = resourceManager_.Acquire(id);
+
+    EXPECT_CALL(loggerMock_, MakeWarnLogEntry(ContainsRegex("atlas.*is still referenced")));
+    EXPECT_FALSE(resourceManager_.Unload(id));
+
+    handle.Reset();
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry(ContainsRegex("Unloaded.*atlas")));
+    EXPECT_TRUE(resourceManager_.Unload(id));
+}
+
+TEST_F(ResourceManagerBudgetTest, CopiedHandleShouldHoldResource)
+{
+    auto id = Add("atlas");
+    auto handle = resourceManager_.Acquire(id);
+    auto copy = handle;
+    handle.Reset();
+
+    EXPECT_EQ(copy.GetId(), id);
+    EXPECT_NE(copy.Get(), nullptr);
+    EXPECT_CALL(loggerMock_, MakeWarnLogEntry(ContainsRegex("atlas.*is still referenced")));
+    EXPECT_FALSE(resourceManager_.Unload(id));
+}
+
+TEST_F(ResourceManagerBudgetTest, GrowingVectorOfHandlesShouldMoveThem)
+{
+    static_assert(std::is_nothrow_move_constructible<SomeResourceManager::Handle>::value,
+                  "vector would copy handles when it grows");
+    auto id = Add("atlas");
+    auto expectedPtr = resourceManager_.Get(id);
+
+    std::vector<SomeResourceManager::Handle> handles;
+    for (int i = 0; i < 10; i++) {
+        handles.push_back(resourceManager_.Acquire(id));
+    }
+    handles.erase(handles.begin() + 1, handles.end());
+    EXPECT_EQ(handles.front().Get(), expectedPtr);
+
+    handles.clear();
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry(ContainsRegex("Unloaded.*atlas")));
+    EXPECT_TRUE(resourceManager_.Unload(id));
+}
+
+TEST_F(ResourceManagerBudgetTest, AcquireUnknownResourceShouldReturnEmptyHandle)
+{
+    EXPECT_CALL(loggerMock_, MakeErrorLogEntry(ContainsRegex("Could not get.*123")));
+    auto handle = resourceManager_.Acquire(123);
+
+    EXPECT_EQ(handle.GetId(), InvalidResourceId);
+}
+
+TEST_F(ResourceManagerBudgetTest, BudgetShouldEvictLeastRecentlyUsed)
+{
+    resourceManager_.SetBudget(250);
+    auto id1 = Add("atlas1");
+    auto id2 = Add("atlas2");
+    // the handles are released at once
+    resourceManager_.Acquire(id1);
+    resourceManager_.Acquire(id2);
+    resourceManager_.Get(id1);
+
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry(ContainsRegex("Unloaded.*atlas2.*200 some bytes held")));
+    auto id3 = Add("atlas3");
+
+    EXPECT_NE(resourceManager_.Get(id1), nullptr);
+    EXPECT_NE(resourceManager_.Get(id3), nullptr);
+    EXPECT_CALL(loggerMock_, MakeErrorLogEntry(ContainsRegex("Could not get")));
+    EXPECT_THAT(resourceManager_.Get(id2), IsNull());
+}
+
+TEST_F(ResourceManagerBudgetTest, BudgetShouldNotEvictHeldResource)
+{
+    resourceManager_.SetBudget(150);
+    auto id1 = Add("atlas1");
+    auto handle = resourceManager_.Acquire(id1);
+    auto id2 = Add("atlas2");
+
+    EXPECT_EQ(resourceManager_.GetBytesHeld(), 200u);
+
+    // atlas1 was got before atlas2 was added
+    EXPECT_CALL(loggerMock_, MakeInfoLogEntry(ContainsRegex("Unloaded.*atlas1.*100 some bytes held")));
+    handle.Reset();
+    EXPECT_NE(resourceManager_.Get(id2), nullptr);
+}
+
+TEST_F(ResourceManagerBudgetTest, BudgetShouldNotEvictResourceThatWasNeverAcquired)
+{
+    resourceManager_.SetBudget(150);
+    auto id1 = Add("atlas1");
+    auto id2 = Add("atlas2");
+
+    EXPECT_EQ(resourceManager_.GetBytesHeld(), 200u);
+    EXPECT_NE(resourceManager_.Get(id1), nullptr);
+    EXPECT_NE(resourceManager_.Get(id2), nullptr);
+}
+
 }  // namespace Shared
 
 }  // namespace FA
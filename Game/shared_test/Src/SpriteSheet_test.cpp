@@ -34,6 +34,15 @@ TEST_F(SpriteSheetTest, AtInsideSheetShouldReturnValidRect)
     EXPECT_THAT(rect, Eq(expected));
 }
 
+TEST_F(SpriteSheetTest, AtInsideSheetWithOffsetShouldReturnOffsetRect)
+{
+    SpriteSheet s(111, {100, 100}, {10, 10}, {200, 300});
+    auto rect = s.At({2, 1});
+    TextureRect expected(111, {220, 310, 10, 10});
+    EXPECT_TRUE(rect.isValid_);
+    EXPECT_THAT(rect, Eq(expected));
+}
+
 TEST_F(SpriteSheetTest, AtOutsideSheetShouldReturnInvalidRect)
 {
     SpriteSheet s(111, {100, 100}, {10, 10});
@@ -0,0 +1,28 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+namespace FA {
+
+namespace Util {
+
+class BinaryWriter;
+class BinaryReader;
+
+}  // namespace Util
+
+namespace Tile {
+
+struct TileMapData;
+
+// Binary form of parsed map data, used by cooked level packages to skip the TMX/TSX parsing
+void WriteTileMapData(Util::BinaryWriter& writer, const TileMapData& data);
+bool ReadTileMapData(Util::BinaryReader& reader, TileMapData& data);
+
+}  // namespace Tile
+
+}  // namespace FA
@@ -0,0 +1,193 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "TileMapBinary.h"
+
+#include "BinaryStream.h"
+#include "TileMapData.h"
+
+namespace FA {
+
+namespace Tile {
+
+namespace {
+
+template <class T, class WriteFn>
+void WriteVector(Util::BinaryWriter& writer, const std::vector<T>& values, WriteFn writeFn)
+{
+    writer.Write(static_cast<std::uint32_t>(values.size()));
+    for (const auto& value : values) {
+        writeFn(value);
+    }
+}
+
+template <class T, class ReadFn>
+void ReadVector(Util::BinaryReader& reader, std::vector<T>& values, ReadFn readFn)
+{
+    auto n = reader.ReadUInt32();
+    for (std::uint32_t i = 0; i < n && reader.IsGood(); i++) {
+        values.push_back(readFn());
+    }
+}
+
+void WriteFrame(Util::BinaryWriter& writer, const Frame& frame)
+{
+    writer.Write(frame.texturePath_);
+    writer.Write(static_cast<std::uint32_t>(frame.column_));
+    writer.Write(static_cast<std::uint32_t>(frame.row_));
+    writer.Write(static_cast<std::uint32_t>(frame.width_));
+    writer.Write(static_cast<std::uint32_t>(frame.height_));
+}
+
+Frame ReadFrame(Util::BinaryReader& reader)
+{
+    Frame frame;
+    frame.texturePath_ = reader.ReadString();
+    frame.column_ = reader.ReadUInt32();
+    frame.row_ = reader.ReadUInt32();
+    frame.width_ = reader.ReadUInt32();
+    frame.height_ = reader.ReadUInt32();
+
+    return frame;
+}
+
+void WriteTileSet(Util::BinaryWriter& writer, const TileSetData& tileSet)
+{
+    WriteVector(writer, tileSet.images_, [&writer](const Image& image) {
+        writer.Write(image.path_);
+        writer.Write(static_cast<std::uint32_t>(image.nCols_));
+        writer.Write(static_cast<std::uint32_t>(image.nRows_));
+    });
+    writer.Write(static_cast<std::uint32_t>(tileSet.lookupTable_.size()));
+    for (const auto& entry : tileSet.lookupTable_) {
+        writer.Write(static_cast<std::int32_t>(entry.first));
+        WriteFrame(writer, entry.second.image_);
+        WriteVector(writer, entry.second.animation_, [&writer](const Frame& frame) { WriteFrame(writer, frame); });
+    }
+}
+
+TileSetData ReadTileSet(Util::BinaryReader& reader)
+{
+    TileSetData tileSet;
+    ReadVector(reader, tileSet.images_, [&reader]() {
+        auto path = reader.ReadString();
+        auto nCols = reader.ReadUInt32();
+        auto nRows = reader.ReadUInt32();
+        return Image(path, nCols, nRows);
+    });
+    auto n = reader.ReadUInt32();
+    for (std::uint32_t i = 0; i < n && reader.IsGood(); i++) {
+        auto id = reader.ReadInt32();
+        TileData tileData;
+        tileData.image_ = ReadFrame(reader);
+        ReadVector(reader, tileData.animation_, [&reader]() { return ReadFrame(reader); });
+        tileSet.lookupTable_[id] = tileData;
+    }
+
+    return tileSet;
+}
+
+void WriteObject(Util::BinaryWriter& writer, const TileMapData::Object& object)
+{
+    writer.Write(static_cast<std::int32_t>(object.id_));
+    writer.Write(object.typeStr_);
+    writer.Write(static_cast<std::int32_t>(object.x_));
+    writer.Write(static_cast<std::int32_t>(object.y_));
+    writer.Write(static_cast<std::int32_t>(object.width_));
+    writer.Write(static_cast<std::int32_t>(object.height_));
+    writer.Write(static_cast<std::uint32_t>(object.properties_.size()));
+    for (const auto& property : object.properties_) {
+        writer.Write(property.first);
+        writer.Write(property.second);
+    }
+}
+
+TileMapData::Object ReadObject(Util::BinaryReader& reader)
+{
+    TileMapData::Object object;
+    object.id_ = reader.ReadInt32();
+    object.typeStr_ = reader.ReadString();
+    object.x_ = reader.ReadInt32();
+    object.y_ = reader.ReadInt32();
+    object.width_ = reader.ReadInt32();
+    object.height_ = reader.ReadInt32();
+    auto n = reader.ReadUInt32();
+    for (std::uint32_t i = 0; i < n && reader.IsGood(); i++) {
+        auto name = reader.ReadString();
+        object.properties_[name] = reader.ReadString();
+    }
+
+    return object;
+}
+
+}  // namespace
+
+void WriteTileMapData(Util::BinaryWriter& writer, const TileMapData& data)
+{
+    const auto& properties = data.mapProperties_;
+    writer.Write(static_cast<std::uint32_t>(properties.width_));
+    writer.Write(static_cast<std::uint32_t>(properties.height_));
+    writer.Write(static_cast<std::uint32_t>(properties.tileWidth_));
+    writer.Write(static_cast<std::uint32_t>(properties.tileHeight_));
+
+    writer.Write(static_cast<std::uint32_t>(data.tileSets_.size()));
+    for (const auto& entry : data.tileSets_) {
+        writer.Write(static_cast<std::int32_t>(entry.first));
+        WriteTileSet(writer, entry.second);
+    }
+
+    WriteVector(writer, data.layers_, [&writer](const TileMapData::Layer& layer) {
+        writer.Write(layer.name_);
+        writer.Write(static_cast<std::uint32_t>(layer.tileIds_.size()));
+        for (auto id : layer.tileIds_) {
+            writer.Write(static_cast<std::int32_t>(id));
+        }
+    });
+
+    WriteVector(writer, data.objectGroups_, [&writer](const TileMapData::ObjectGroup& group) {
+        writer.Write(group.name_);
+        WriteVector(writer, group.objects_,
+                    [&writer](const TileMapData::Object& object) { WriteObject(writer, object); });
+    });
+}
+
+bool ReadTileMapData(Util::BinaryReader& reader, TileMapData& data)
+{
+    auto& properties = data.mapProperties_;
+    properties.width_ = reader.ReadUInt32();
+    properties.height_ = reader.ReadUInt32();
+    properties.tileWidth_ = reader.ReadUInt32();
+    properties.tileHeight_ = reader.ReadUInt32();
+
+    auto nTileSets = reader.ReadUInt32();
+    for (std::uint32_t i = 0; i < nTileSets && reader.IsGood(); i++) {
+        auto firstGid = reader.ReadInt32();
+        data.tileSets_[firstGid] = ReadTileSet(reader);
+    }
+
+    ReadVector(reader, data.layers_, [&reader]() {
+        TileMapData::Layer layer;
+        layer.name_ = reader.ReadString();
+        auto n = reader.ReadUInt32();
+        for (std::uint32_t i = 0; i < n && reader.IsGood(); i++) {
+            layer.tileIds_.push_back(reader.ReadInt32());
+        }
+        return layer;
+    });
+
+    ReadVector(reader, data.objectGroups_, [&reader]() {
+        TileMapData::ObjectGroup group;
+        group.name_ = reader.ReadString();
+        ReadVector(reader, group.objects_, [&reader]() { return ReadObject(reader); });
+        return group;
+    });
+
+    return reader.IsGood();
+}
+
+}  // namespace Tile
+
+}  // namespace FA
@@ -12,6 +12,7 @@
 #include "ByteStreamFactory.h"
 #include "Folder.h"
 #include "ParseHelper.h"
+#include "Profiler.h"
 #include "TileMapData.h"
 #include "TileService.h"
 #include "TileSetFactory.h"
@@ -34,6 +35,7 @@ TileMapParser::~TileMapParser() = default;
 
 TileMapData TileMapParser::Run(const std::string& fileName)
 {
+    PROFILE_SCOPE("TileMapParser::Run");
     LOG_TMXINFO("Parse %s", fileName.c_str());
     LOG_TMXINFO("Start parse fileName %s", fileName.c_str());
     TileMapData tileMapData;
@@ -0,0 +1,68 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <sstream>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "BinaryStream.h"
+#include "TileMapBinary.h"
+#include "TileMapData.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Tile {
+
+class TileMapBinaryTest : public Test
+{
+protected:
+    TileMapData CreateTileMapData() const
+    {
+        TileMapData data;
+        data.mapProperties_ = {30, 20, 16, 16};
+        Frame f1{"dev/dir/tiles.png", 1, 4, 16, 16};
+        Frame f2{"dev/dir/tiles.png", 2, 4, 16, 16};
+        data.tileSets_[1] = TileSetData{{{"dev/dir/tiles.png", 10, 10}}, {{0, {f1, {}}}, {1, {f1, {f1, f2}}}}};
+        data.tileSets_[101] = TileSetData{{{"dev/dir/tree.png"}}, {{0, {{"dev/dir/tree.png", 0, 0, 32, 48}, {}}}}};
+        data.layers_ = {{"Ground Layer 1", {1, 2, 0, 101}}, {"Fringe Layer", {0, 0, 0, 0}}};
+        TileMapData::Object object{7, "Mole", 48, 64, 16, 16, {{"FaceDirection", "Down"}}};
+        data.objectGroups_ = {{"Object Layer 1", {object}}, {"Collision Layer 1", {}}};
+        return data;
+    }
+};
+
+TEST_F(TileMapBinaryTest, ReadShouldGiveWrittenData)
+{
+    std::stringstream ss;
+    Util::BinaryWriter writer(ss);
+    auto expected = CreateTileMapData();
+    WriteTileMapData(writer, expected);
+
+    Util::BinaryReader reader(ss);
+    TileMapData result;
+    EXPECT_TRUE(ReadTileMapData(reader, result));
+    EXPECT_THAT(result, Eq(expected));
+}
+
+TEST_F(TileMapBinaryTest, ReadTruncatedDataShouldFail)
+{
+    std::stringstream ss;
+    Util::BinaryWriter writer(ss);
+    WriteTileMapData(writer, CreateTileMapData());
+    auto buffer = ss.str();
+    std::stringstream truncated(buffer.substr(0, buffer.size() / 2));
+
+    Util::BinaryReader reader(truncated);
+    TileMapData result;
+    EXPECT_FALSE(ReadTileMapData(reader, result));
+}
+
+}  // namespace Tile
+
+}  // namespace FA
@@ -0,0 +1,54 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace FA {
+
+namespace Util {
+
+// Values are stored little endian with fixed width, strings and blobs are prefixed with their size
+class BinaryWriter
+{
+public:
+    BinaryWriter(std::ostream& os);
+
+    void Write(std::uint32_t value);
+    void Write(std::int32_t value);
+    void Write(const std::string& value);
+    void Write(const void* data, std::size_t size);
+
+    bool IsGood() const;
+
+private:
+    std::ostream& os_;
+};
+
+// Reads what BinaryWriter wrote, after a failed read all further reads fail and return zero values
+class BinaryReader
+{
+public:
+    BinaryReader(std::istream& is);
+
+    std::uint32_t ReadUInt32();
+    std::int32_t ReadInt32();
+    std::string ReadString();
+    bool Read(void* data, std::size_t size);
+
+    bool IsGood() const;
+
+private:
+    std::istream& is_;
+    bool good_ = true;
+};
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,53 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <ctime>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace FA {
+
+namespace Util {
+
+/* Polls the modification time of files, for reloading assets while running. A change is reported
+ * when the time has been the same for two polls, so a file that is still being written is not read.
+ */
+class FileWatcher
+{
+public:
+    using ModifiedFn = std::function<std::time_t(const std::string&)>;  // 0 when the file is missing
+
+    FileWatcher(float interval, ModifiedFn modifiedFn = nullptr);
+
+    static std::time_t GetModifiedTime(const std::string& path);  // 0 when the file is missing
+
+    void Add(const std::string& path);
+    void Clear() { files_.clear(); }
+    std::vector<std::string> Update(float deltaTime);  // files that changed, empty between polls
+
+private:
+    struct File
+    {
+        std::string path_;
+        std::time_t reported_{};
+        std::time_t seen_{};
+    };
+
+    const float interval_;
+    ModifiedFn modifiedFn_;
+    float time_{};
+    std::vector<File> files_;
+
+private:
+    std::vector<std::string> Poll();
+};
+
+}  // namespace Util
+
+}  // namespace FA
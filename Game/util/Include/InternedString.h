@@ -0,0 +1,64 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace FA {
+
+namespace Util {
+
+/* Equal strings share one entry in a process wide table that is never shrunk, so an interned string is
+ * compared by pointer and has its hash computed once, when it is interned. Interning is thread safe.
+ */
+class InternedString
+{
+public:
+    InternedString();  // the empty string
+    InternedString(const std::string& str);
+    InternedString(const char* str);
+
+    const std::string& Str() const { return entry_->str_; }
+    std::size_t Hash() const { return entry_->hash_; }
+
+    friend bool operator==(const InternedString& lhs, const InternedString& rhs) { return lhs.entry_ == rhs.entry_; }
+    friend bool operator!=(const InternedString& lhs, const InternedString& rhs) { return lhs.entry_ != rhs.entry_; }
+
+private:
+    struct Entry
+    {
+        std::string str_;
+        std::size_t hash_{};
+    };
+
+    const Entry* entry_;
+
+private:
+    static const Entry* Intern(const std::string& str);
+};
+
+inline std::ostream& operator<<(std::ostream& os, const InternedString& str)
+{
+    return os << str.Str();
+}
+
+}  // namespace Util
+
+}  // namespace FA
+
+namespace std {
+
+template <>
+struct hash<FA::Util::InternedString>
+{
+    std::size_t operator()(const FA::Util::InternedString& str) const { return str.Hash(); }
+};
+
+}  // namespace std
@@ -9,6 +9,7 @@
 #include "LoggerIf.h"
 
 #include <fstream>
+#include <mutex>
 #include <string>
 
 namespace FA {
@@ -39,6 +40,7 @@ private:
     std::ofstream::pos_type currSize_;
     std::ofstream::pos_type maxSize_ = 1048576;  // arbitrary number
     bool toConsole_{false};
+    std::mutex mutex_;  // entries are made from loader and worker threads too
 
 private:
     void LogStr(const std::string& logStr);
@@ -0,0 +1,162 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Instrumentation is enabled by default in debug builds, define FA_PROFILER=0/1 to override
+#ifndef FA_PROFILER
+#ifdef _DEBUG
+#define FA_PROFILER 1
+#else
+#define FA_PROFILER 0
+#endif
+#endif
+
+namespace FA {
+
+namespace Util {
+
+class Profiler
+{
+public:
+    using ScopeId = std::size_t;
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t nFrames = 256;  // history per thread
+    static constexpr std::size_t maxScopes = 64;
+    static constexpr std::size_t maxEvents = 65536;  // per thread, oldest events are overwritten
+    static constexpr ScopeId InvalidScopeId = maxScopes;
+
+    struct Stats
+    {
+        float min_{};  // milliseconds
+        float avg_{};
+        float p99_{};
+        std::size_t nFrames_{};
+    };
+
+    struct Event
+    {
+        ScopeId id_{};
+        std::int64_t start_{};  // nanoseconds since profiler was created
+        std::int64_t duration_{};
+    };
+
+    struct Trace
+    {
+        struct Thread
+        {
+            std::size_t id_{};  // 1, 2, ... in order of first record
+            std::string name_;
+            std::vector<Event> events_;  // oldest first
+        };
+
+        std::vector<std::string> scopeNames_;
+        std::vector<Thread> threads_;
+    };
+
+public:
+    Profiler();
+
+    static Profiler& Instance();
+
+    ScopeId RegisterScope(const std::string& name);
+    void Record(ScopeId id, Clock::duration duration);
+    void Record(ScopeId id, Clock::time_point start, Clock::time_point end);
+    void EndFrame();
+    void SetThreadName(const std::string& name);
+
+    std::vector<std::string> GetScopeNames() const;
+    std::vector<float> GetSamples(const std::string& name) const;  // milliseconds per frame, oldest first
+    Stats GetStats(const std::string& name) const;
+    Trace GetTrace() const;
+
+private:
+    // A sequence lock, the sequence is odd while the event is written and grows by 2 per write
+    struct EventSlot
+    {
+        std::atomic<std::uint64_t> sequence_{0};
+        std::atomic<ScopeId> id_{};
+        std::atomic<std::int64_t> start_{};
+        std::atomic<std::int64_t> duration_{};
+    };
+
+    /* Written by the owning thread only, completed frames and events can be read from any thread.
+     * When a new thread takes over the data of a thread that has exited, the events are retired.
+     */
+    struct ThreadData
+    {
+        std::thread::id threadId_;
+        std::shared_ptr<std::atomic<bool>> exited_ = std::make_shared<std::atomic<bool>>(false);
+        std::size_t index_{};
+        std::string name_;
+        std::array<std::int64_t, maxScopes> current_{};
+        std::array<std::array<std::atomic<std::int64_t>, maxScopes>, nFrames> frames_{};
+        std::array<std::atomic<bool>, maxScopes> used_{};
+        std::atomic<std::size_t> frameCount_{0};
+        std::unique_ptr<EventSlot[]> events_;  // on first event, most threads are never traced
+        std::atomic<std::size_t> nEvents_{0};
+    };
+
+    const std::size_t instanceId_;
+    const Clock::time_point epoch_;
+    mutable std::mutex mutex_;
+    std::vector<std::string> names_;
+    std::vector<std::unique_ptr<ThreadData>> threads_;
+    mutable std::vector<Trace::Thread> retired_;  // events of exited threads, until they are traced
+    std::size_t nThreads_{};
+
+private:
+    ThreadData& GetThreadData();
+    void Reset(ThreadData& data);
+    static Trace::Thread ReadEvents(const ThreadData& data);
+    ScopeId FindScope(const std::string& name) const;
+};
+
+class ProfileScope
+{
+public:
+    ProfileScope(Profiler::ScopeId id)
+        : id_(id)
+        , start_(Profiler::Clock::now())
+    {}
+
+    ~ProfileScope() { Profiler::Instance().Record(id_, start_, Profiler::Clock::now()); }
+
+private:
+    Profiler::ScopeId id_;
+    Profiler::Clock::time_point start_;
+};
+
+}  // namespace Util
+
+}  // namespace FA
+
+#define FA_PROFILER_CONCAT_IMPL(a, b) a##b
+#define FA_PROFILER_CONCAT(a, b) FA_PROFILER_CONCAT_IMPL(a, b)
+
+#if FA_PROFILER
+#define PROFILE_SCOPE(name)                                                        \
+    static const auto FA_PROFILER_CONCAT(profileScopeId, __LINE__) =               \
+        ::FA::Util::Profiler::Instance().RegisterScope(name);                      \
+    ::FA::Util::ProfileScope FA_PROFILER_CONCAT(profileScope, __LINE__)(FA_PROFILER_CONCAT(profileScopeId, __LINE__))
+#define PROFILE_END_FRAME() ::FA::Util::Profiler::Instance().EndFrame()
+#define PROFILE_THREAD_NAME(name) ::FA::Util::Profiler::Instance().SetThreadName(name)
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_END_FRAME()
+#define PROFILE_THREAD_NAME(name)
+#endif
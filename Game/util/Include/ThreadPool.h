@@ -0,0 +1,64 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace FA {
+
+namespace Util {
+
+// Runs tasks on a fixed set of worker threads, in the order they are submitted
+class ThreadPool
+{
+public:
+    ThreadPool(std::size_t nThreads);
+    ~ThreadPool();  // finishes queued tasks before returning
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static ThreadPool& Instance();  // one thread per core
+
+    template <class F>
+    auto Submit(F&& f) -> std::future<decltype(f())>
+    {
+        using Result = decltype(f());
+        // std::function must be copyable, packaged_task is not
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+        auto future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back([task]() { (*task)(); });
+        }
+        cv_.notify_one();
+
+        return future;
+    }
+
+    std::size_t GetNumberOfThreads() const { return threads_.size(); }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
+
+private:
+    void Run();
+};
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,54 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "Profiler.h"
+
+namespace FA {
+
+namespace Util {
+
+// Writes profiler traces as Chrome trace event JSON (chrome://tracing, ui.perfetto.dev) on a worker thread
+class TraceWriter
+{
+public:
+    TraceWriter();
+    ~TraceWriter();  // finishes queued traces before returning
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    void Write(Profiler::Trace trace, const std::string& filePath);
+
+    static void ToJson(const Profiler::Trace& trace, std::ostream& os);
+
+private:
+    struct Job
+    {
+        Profiler::Trace trace_;
+        std::string filePath_;
+    };
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Job> jobs_;
+    bool stop_ = false;
+    std::thread thread_;
+
+private:
+    void Run();
+};
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,117 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "BinaryStream.h"
+
+#include <istream>
+#include <ostream>
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+// Upper limit for a single string or blob, guards against allocating from a corrupt size field
+constexpr std::uint32_t maxBlobSize = 256 * 1024 * 1024;
+
+}  // namespace
+
+BinaryWriter::BinaryWriter(std::ostream& os)
+    : os_(os)
+{}
+
+void BinaryWriter::Write(std::uint32_t value)
+{
+    char bytes[4];
+    for (int i = 0; i < 4; i++) {
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+    os_.write(bytes, sizeof(bytes));
+}
+
+void BinaryWriter::Write(std::int32_t value)
+{
+    Write(static_cast<std::uint32_t>(value));
+}
+
+void BinaryWriter::Write(const std::string& value)
+{
+    Write(value.data(), value.size());
+}
+
+void BinaryWriter::Write(const void* data, std::size_t size)
+{
+    Write(static_cast<std::uint32_t>(size));
+    os_.write(static_cast<const char*>(data), size);
+}
+
+bool BinaryWriter::IsGood() const
+{
+    return os_.good();
+}
+
+BinaryReader::BinaryReader(std::istream& is)
+    : is_(is)
+{}
+
+std::uint32_t BinaryReader::ReadUInt32()
+{
+    unsigned char bytes[4]{};
+    if (good_ && !is_.read(reinterpret_cast<char*>(bytes), sizeof(bytes))) good_ = false;
+    if (!good_) return 0;
+
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= static_cast<std::uint32_t>(bytes[i]) << (8 * i);
+    }
+
+    return value;
+}
+
+std::int32_t BinaryReader::ReadInt32()
+{
+    return static_cast<std::int32_t>(ReadUInt32());
+}
+
+std::string BinaryReader::ReadString()
+{
+    auto size = ReadUInt32();
+    if (!good_ || size > maxBlobSize) {
+        good_ = false;
+        return {};
+    }
+
+    std::string value(size, '\0');
+    if (size > 0 && !is_.read(&value[0], size)) {
+        good_ = false;
+        return {};
+    }
+
+    return value;
+}
+
+// The stored size must match the expected size
+bool BinaryReader::Read(void* data, std::size_t size)
+{
+    auto storedSize = ReadUInt32();
+    if (!good_ || storedSize != size) {
+        good_ = false;
+        return false;
+    }
+    if (size > 0 && !is_.read(static_cast<char*>(data), size)) good_ = false;
+
+    return good_;
+}
+
+bool BinaryReader::IsGood() const
+{
+    return good_;
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,69 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "FileWatcher.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+
+#include "Profiler.h"
+
+namespace FA {
+
+namespace Util {
+
+FileWatcher::FileWatcher(float interval, ModifiedFn modifiedFn)
+    : interval_(interval)
+    , modifiedFn_(modifiedFn ? modifiedFn : GetModifiedTime)
+{}
+
+std::time_t FileWatcher::GetModifiedTime(const std::string& path)
+{
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) return 0;
+
+    return info.st_mtime;
+}
+
+void FileWatcher::Add(const std::string& path)
+{
+    auto it = std::find_if(files_.begin(), files_.end(), [&path](const File& file) { return file.path_ == path; });
+    if (it != files_.end()) return;
+
+    auto modified = modifiedFn_(path);
+    files_.push_back({path, modified, modified});
+}
+
+std::vector<std::string> FileWatcher::Update(float deltaTime)
+{
+    time_ += deltaTime;
+    if (time_ < interval_) return {};
+
+    time_ = 0.0f;
+    return Poll();
+}
+
+std::vector<std::string> FileWatcher::Poll()
+{
+    PROFILE_SCOPE("FileWatcher::Poll");
+    std::vector<std::string> changed;
+    for (auto& file : files_) {
+        auto modified = modifiedFn_(file.path_);
+        // a missing file is likely being replaced, it is reported once it is back
+        if (modified != 0 && modified == file.seen_ && modified != file.reported_) {
+            file.reported_ = modified;
+            changed.push_back(file.path_);
+        }
+        file.seen_ = modified;
+    }
+
+    return changed;
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,48 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "InternedString.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace FA {
+
+namespace Util {
+
+InternedString::InternedString()
+    : entry_(Intern(std::string()))
+{}
+
+InternedString::InternedString(const std::string& str)
+    : entry_(Intern(str))
+{}
+
+InternedString::InternedString(const char* str)
+    : entry_(Intern(str))
+{}
+
+const InternedString::Entry* InternedString::Intern(const std::string& str)
+{
+    // Function local, strings are interned during static initialization, e.g. by sheet items
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<Entry>> entries;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& entry = entries[str];
+    if (!entry) {
+        entry = std::make_unique<Entry>();
+        entry->str_ = str;
+        entry->hash_ = std::hash<std::string>()(str);
+    }
+
+    return entry.get();
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -31,6 +31,7 @@ void Logger::OpenLog(const std::string& folder, const std::string& fileName, boo
 {
     if (!FolderExists(folder)) return;
 
+    std::lock_guard<std::mutex> lock(mutex_);
     toConsole_ = toConsole;
     filePath_ = folder + '/' + fileName;
     logStream_.open(filePath_);
@@ -48,6 +49,7 @@ void Logger::OpenLog(const std::string& folder, const std::string& fileName, boo
 
 void Logger::CloseLog()
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     if (logStream_.is_open()) {
         ClosingLines();
         logStream_.close();
@@ -95,6 +97,7 @@ void Logger::LogStr(const std::string& logStr)
 
 void Logger::LogEntry(const Entry& entry)
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     LogStr(entry.Str());
     EndLine();
 }
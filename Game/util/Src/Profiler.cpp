@@ -0,0 +1,271 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+/* Identify profiler by instance id rather than address, a new profiler can reuse the address of a destroyed one.
+ * The exited flag is shared with the thread data, so it can be set when the profiler is gone.
+ */
+struct ThreadCache
+{
+    ~ThreadCache()
+    {
+        if (exited_) exited_->store(true);
+    }
+
+    std::size_t instanceId_{};
+    void* data_ = nullptr;
+    std::shared_ptr<std::atomic<bool>> exited_;
+};
+
+std::atomic<std::size_t> nextInstanceId{1};
+thread_local ThreadCache threadCache;
+
+float ToMs(std::int64_t ns)
+{
+    return static_cast<float>(ns) / 1000000.0f;
+}
+
+}  // namespace
+
+constexpr std::size_t Profiler::nFrames;
+constexpr std::size_t Profiler::maxScopes;
+constexpr std::size_t Profiler::maxEvents;
+constexpr Profiler::ScopeId Profiler::InvalidScopeId;
+
+Profiler::Profiler()
+    : instanceId_(nextInstanceId++)
+    , epoch_(Clock::now())
+{}
+
+Profiler& Profiler::Instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::ScopeId Profiler::RegisterScope(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find(names_.begin(), names_.end(), name);
+    if (it != names_.end()) return std::distance(names_.begin(), it);
+    if (names_.size() >= maxScopes) return InvalidScopeId;
+
+    names_.push_back(name);
+    return names_.size() - 1;
+}
+
+void Profiler::Record(ScopeId id, Clock::duration duration)
+{
+    if (id >= maxScopes) return;
+
+    auto& data = GetThreadData();
+    data.current_[id] += std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    if (!data.used_[id].load(std::memory_order_relaxed)) data.used_[id].store(true, std::memory_order_relaxed);
+}
+
+void Profiler::Record(ScopeId id, Clock::time_point start, Clock::time_point end)
+{
+    if (id >= maxScopes) return;
+
+    Record(id, end - start);
+    auto& data = GetThreadData();
+    if (!data.events_) data.events_ = std::make_unique<EventSlot[]>(maxEvents);
+
+    auto n = data.nEvents_.load(std::memory_order_relaxed);
+    auto& slot = data.events_[n % maxEvents];
+    auto sequence = 2 * (n / maxEvents);
+    slot.sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.id_.store(id, std::memory_order_relaxed);
+    slot.start_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(start - epoch_).count(),
+                      std::memory_order_relaxed);
+    slot.duration_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(),
+                         std::memory_order_relaxed);
+    slot.sequence_.store(sequence + 2, std::memory_order_release);
+    data.nEvents_.store(n + 1, std::memory_order_release);
+}
+
+void Profiler::EndFrame()
+{
+    auto& data = GetThreadData();
+    auto count = data.frameCount_.load(std::memory_order_relaxed);
+    auto& frame = data.frames_[count % nFrames];
+
+    for (std::size_t id = 0; id < maxScopes; id++) {
+        frame[id].store(data.current_[id], std::memory_order_relaxed);
+        data.current_[id] = 0;
+    }
+
+    data.frameCount_.store(count + 1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const std::string& name)
+{
+    auto& data = GetThreadData();
+    std::lock_guard<std::mutex> lock(mutex_);
+    data.name_ = name;
+}
+
+std::vector<std::string> Profiler::GetScopeNames() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return names_;
+}
+
+std::vector<float> Profiler::GetSamples(const std::string& name) const
+{
+    std::vector<float> samples;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto id = FindScope(name);
+    if (id == InvalidScopeId) return samples;
+
+    for (const auto& data : threads_) {
+        if (!data->used_[id].load(std::memory_order_relaxed)) continue;
+        auto count = data->frameCount_.load(std::memory_order_acquire);
+        // the slot after the latest completed frame might be written to right now, leave it out
+        auto n = std::min(count, nFrames - 1);
+        for (auto i = count - n; i < count; i++) {
+            samples.push_back(ToMs(data->frames_[i % nFrames][id].load(std::memory_order_relaxed)));
+        }
+    }
+
+    return samples;
+}
+
+Profiler::Stats Profiler::GetStats(const std::string& name) const
+{
+    Stats stats;
+    auto samples = GetSamples(name);
+    if (samples.empty()) return stats;
+
+    std::sort(samples.begin(), samples.end());
+    auto n = samples.size();
+    auto p99Index = static_cast<std::size_t>(std::ceil(0.99f * n)) - 1;
+    stats.min_ = samples.front();
+    stats.avg_ = std::accumulate(samples.begin(), samples.end(), 0.0f) / n;
+    stats.p99_ = samples[p99Index];
+    stats.nFrames_ = n;
+
+    return stats;
+}
+
+// Events of exited threads are only in the first trace after the threads have exited
+Profiler::Trace Profiler::GetTrace() const
+{
+    Trace trace;
+    std::lock_guard<std::mutex> lock(mutex_);
+    trace.scopeNames_ = names_;
+    trace.threads_ = std::move(retired_);
+    retired_.clear();
+
+    for (const auto& data : threads_) {
+        trace.threads_.push_back(ReadEvents(*data));
+    }
+    std::sort(trace.threads_.begin(), trace.threads_.end(),
+              [](const Trace::Thread& a, const Trace::Thread& b) { return a.id_ < b.id_; });
+
+    return trace;
+}
+
+Profiler::ThreadData& Profiler::GetThreadData()
+{
+    if (threadCache.instanceId_ != instanceId_) {
+        auto threadId = std::this_thread::get_id();
+        std::lock_guard<std::mutex> lock(mutex_);
+        // ids of exited threads can be reused by new threads
+        auto it = std::find_if(threads_.begin(), threads_.end(), [threadId](const std::unique_ptr<ThreadData>& d) {
+            return d->threadId_ == threadId && !d->exited_->load();
+        });
+        if (it == threads_.end()) {
+            it = std::find_if(threads_.begin(), threads_.end(),
+                              [](const std::unique_ptr<ThreadData>& d) { return d->exited_->load(); });
+            if (it != threads_.end()) {
+                Reset(**it);
+            }
+            else {
+                threads_.push_back(std::make_unique<ThreadData>());
+                it = std::prev(threads_.end());
+            }
+            (*it)->threadId_ = threadId;
+            (*it)->index_ = ++nThreads_;
+        }
+        threadCache.instanceId_ = instanceId_;
+        threadCache.data_ = it->get();
+        threadCache.exited_ = (*it)->exited_;
+    }
+
+    return *static_cast<ThreadData*>(threadCache.data_);
+}
+
+Profiler::Trace::Thread Profiler::ReadEvents(const ThreadData& data)
+{
+    Trace::Thread thread;
+    thread.id_ = data.index_;
+    thread.name_ = data.name_;
+    // events_ is set before the first event is published
+    auto count = data.nEvents_.load(std::memory_order_acquire);
+    auto n = std::min(count, maxEvents);
+    thread.events_.reserve(n);
+    for (auto i = count - n; i < count; i++) {
+        const auto& slot = data.events_[i % maxEvents];
+        // a slot that is written, or already holds a newer event, is left out
+        auto sequence = 2 * (i / maxEvents + 1);
+        if (slot.sequence_.load(std::memory_order_acquire) != sequence) continue;
+        Event event;
+        event.id_ = slot.id_.load(std::memory_order_relaxed);
+        event.start_ = slot.start_.load(std::memory_order_relaxed);
+        event.duration_ = slot.duration_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence_.load(std::memory_order_relaxed) != sequence) continue;
+        thread.events_.push_back(event);
+    }
+
+    return thread;
+}
+
+/* Called with the lock held, the exited thread does not write any longer and readers take the lock.
+ * Its events are kept for the next trace, only its counters are taken over.
+ */
+void Profiler::Reset(ThreadData& data)
+{
+    if (data.nEvents_.load(std::memory_order_relaxed) > 0) retired_.push_back(ReadEvents(data));
+    data.exited_ = std::make_shared<std::atomic<bool>>(false);
+    data.name_.clear();
+    data.current_.fill(0);
+    for (auto& frame : data.frames_) {
+        for (auto& value : frame) {
+            value.store(0, std::memory_order_relaxed);
+        }
+    }
+    for (auto& used : data.used_) {
+        used.store(false, std::memory_order_relaxed);
+    }
+    data.frameCount_.store(0, std::memory_order_relaxed);
+    // the ring is freed rather than cleared, the new thread may never trace
+    data.events_.reset();
+    data.nEvents_.store(0, std::memory_order_relaxed);
+}
+
+Profiler::ScopeId Profiler::FindScope(const std::string& name) const
+{
+    auto it = std::find(names_.begin(), names_.end(), name);
+    return it != names_.end() ? std::distance(names_.begin(), it) : InvalidScopeId;
+}
+
+}  // namespace Util
+
+}  // namespace FA
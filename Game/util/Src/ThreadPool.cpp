@@ -0,0 +1,61 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+#include "Profiler.h"
+
+namespace FA {
+
+namespace Util {
+
+ThreadPool::ThreadPool(std::size_t nThreads)
+{
+    for (std::size_t i = 0; i < std::max<std::size_t>(nThreads, 1); i++) {
+        threads_.emplace_back(&ThreadPool::Run, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+ThreadPool& ThreadPool::Instance()
+{
+    // hardware_concurrency may return 0 when it is not known
+    static ThreadPool threadPool(std::thread::hardware_concurrency());
+    return threadPool;
+}
+
+void ThreadPool::Run()
+{
+    PROFILE_THREAD_NAME("Worker");
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) return;
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+}  // namespace Util
+
+}  // namespace FA
@@ -0,0 +1,102 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "TraceWriter.h"
+
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+
+namespace FA {
+
+namespace Util {
+
+namespace {
+
+std::string Escape(const std::string& str)
+{
+    std::string result;
+    for (auto c : str) {
+        if (c == '"' || c == '\\') result += '\\';
+        result += c;
+    }
+
+    return result;
+}
+
+}  // namespace
+
+TraceWriter::TraceWriter()
+    : thread_(&TraceWriter::Run, this)
+{}
+
+TraceWriter::~TraceWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+}
+
+void TraceWriter::Write(Profiler::Trace trace, const std::string& filePath)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back({std::move(trace), filePath});
+    }
+    cv_.notify_one();
+}
+
+void TraceWriter::ToJson(const Profiler::Trace& trace, std::ostream& os)
+{
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    os << std::fixed << std::setprecision(3);
+    bool first = true;
+    auto separator = [&os, &first]() {
+        if (!first) os << ",\n";
+        first = false;
+    };
+
+    for (const auto& thread : trace.threads_) {
+        if (!thread.name_.empty()) {
+            separator();
+            os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.id_
+               << ",\"args\":{\"name\":\"" << Escape(thread.name_) << "\"}}";
+        }
+        for (const auto& event : thread.events_) {
+            if (event.id_ >= trace.scopeNames_.size()) continue;
+            separator();
+            os << "{\"name\":\"" << Escape(trace.scopeNames_[event.id_]) << "\",\"ph\":\"X\",\"ts\":"
+               << event.start_ / 1000.0 << ",\"dur\":" << event.duration_ / 1000.0 << ",\"pid\":1,\"tid\":"
+               << thread.id_ << "}";
+        }
+    }
+
+    os << "]}\n";
+}
+
+void TraceWriter::Run()
+{
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
+            if (jobs_.empty()) return;
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+
+        std::ofstream file(job.filePath_);
+        if (file.is_open()) ToJson(job.trace_, file);
+    }
+}
+
+}  // namespace Util
+
+}  // namespace FA
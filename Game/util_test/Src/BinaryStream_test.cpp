@@ -0,0 +1,86 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <sstream>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "BinaryStream.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+class BinaryStreamTest : public Test
+{
+protected:
+    std::stringstream ss_;
+    BinaryWriter writer_{ss_};
+};
+
+TEST_F(BinaryStreamTest, ValuesShouldBeReadBackInOrder)
+{
+    const char blob[] = {1, 2, 3};
+    writer_.Write(std::uint32_t(0xdeadbeef));
+    writer_.Write(std::int32_t(-42));
+    writer_.Write(std::string("forest"));
+    writer_.Write(blob, sizeof(blob));
+    EXPECT_TRUE(writer_.IsGood());
+
+    BinaryReader reader(ss_);
+    char readBlob[3]{};
+    EXPECT_EQ(reader.ReadUInt32(), 0xdeadbeef);
+    EXPECT_EQ(reader.ReadInt32(), -42);
+    EXPECT_EQ(reader.ReadString(), "forest");
+    EXPECT_TRUE(reader.Read(readBlob, sizeof(readBlob)));
+    EXPECT_THAT(readBlob, ElementsAre(1, 2, 3));
+    EXPECT_TRUE(reader.IsGood());
+}
+
+TEST_F(BinaryStreamTest, ValuesShouldBeLittleEndian)
+{
+    writer_.Write(std::uint32_t(0x04030201));
+
+    EXPECT_EQ(ss_.str(), std::string("\x01\x02\x03\x04"));
+}
+
+TEST_F(BinaryStreamTest, ReadPastEndShouldFail)
+{
+    writer_.Write(std::uint32_t(1));
+
+    BinaryReader reader(ss_);
+    EXPECT_EQ(reader.ReadUInt32(), 1u);
+    EXPECT_EQ(reader.ReadUInt32(), 0u);
+    EXPECT_FALSE(reader.IsGood());
+}
+
+TEST_F(BinaryStreamTest, ReadBlobWithOtherSizeShouldFail)
+{
+    const char blob[] = {1, 2, 3};
+    writer_.Write(blob, sizeof(blob));
+
+    BinaryReader reader(ss_);
+    char readBlob[4]{};
+    EXPECT_FALSE(reader.Read(readBlob, sizeof(readBlob)));
+    EXPECT_FALSE(reader.IsGood());
+}
+
+TEST_F(BinaryStreamTest, ReadTruncatedStringShouldFail)
+{
+    writer_.Write(std::uint32_t(100));
+    writer_.Write(std::uint32_t(0));
+
+    BinaryReader reader(ss_);
+    EXPECT_EQ(reader.ReadString(), "");
+    EXPECT_FALSE(reader.IsGood());
+}
+
+}  // namespace Util
+
+}  // namespace FA
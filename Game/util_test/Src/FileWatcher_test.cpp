@@ -0,0 +1,94 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <ctime>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "FileWatcher.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+class FileWatcherTest : public Test
+{
+protected:
+    FileWatcherTest()
+        : fileWatcher_(interval_, modifiedFn_.AsStdFunction())
+    {}
+
+    const float interval_ = 0.5f;
+    const std::string path_ = "assets/map/level.tmx";
+    MockFunction<std::time_t(const std::string&)> modifiedFn_;
+    FileWatcher fileWatcher_;
+};
+
+TEST_F(FileWatcherTest, UnchangedFileShouldNotBeReported)
+{
+    EXPECT_CALL(modifiedFn_, Call(path_)).WillRepeatedly(Return(100));
+    fileWatcher_.Add(path_);
+
+    EXPECT_THAT(fileWatcher_.Update(interval_), IsEmpty());
+    EXPECT_THAT(fileWatcher_.Update(interval_), IsEmpty());
+}
+
+TEST_F(FileWatcherTest, ChangedFileShouldBeReportedOnceWhenSettled)
+{
+    EXPECT_CALL(modifiedFn_, Call(path_)).WillOnce(Return(100)).WillRepeatedly(Return(101));
+    fileWatcher_.Add(path_);
+
+    EXPECT_THAT(fileWatcher_.Update(interval_), IsEmpty());
+    EXPECT_THAT(fileWatcher_.Update(interval_), ElementsAre(path_));
+    EXPECT_THAT(fileWatcher_.Update(interval_), IsEmpty());
+}
+
+TEST_F(FileWatcherTest, FileShouldOnlyBePolledEachInterval)
+{
+    EXPECT_CALL(modifiedFn_, Call(path_)).WillOnce(Return(100));
+    fileWatcher_.Add(path_);
+
+    EXPECT_THAT(fileWatcher_.Update(interval_ / 2), IsEmpty());
+}
+
+TEST_F(FileWatcherTest, MissingFileShouldBeReportedWhenBack)
+{
+    EXPECT_CALL(modifiedFn_, Call(path_))
+        .WillOnce(Return(100))
+        .WillOnce(Return(0))
+        .WillOnce(Return(0))
+        .WillRepeatedly(Return(102));
+    fileWatcher_.Add(path_);
+
+    EXPECT_THAT(fileWatcher_.Update(interval_), IsEmpty());
+    EXPECT_THAT(fileWatcher_.Update(interval_), IsEmpty());
+    EXPECT_THAT(fileWatcher_.Update(interval_), IsEmpty());
+    EXPECT_THAT(fileWatcher_.Update(interval_), ElementsAre(path_));
+}
+
+TEST_F(FileWatcherTest, FileAddedTwiceShouldBeReportedOnce)
+{
+    EXPECT_CALL(modifiedFn_, Call(path_)).WillOnce(Return(100));
+    fileWatcher_.Add(path_);
+    fileWatcher_.Add(path_);
+
+    EXPECT_CALL(modifiedFn_, Call(path_)).WillRepeatedly(Return(101));
+    EXPECT_THAT(fileWatcher_.Update(interval_), IsEmpty());
+    EXPECT_THAT(fileWatcher_.Update(interval_), ElementsAre(path_));
+}
+
+TEST(FileWatcher, ModifiedTimeOfMissingFileShouldBeZero)
+{
+    EXPECT_EQ(FileWatcher::GetModifiedTime("missing/level.tmx"), 0);
+}
+
+}  // namespace Util
+
+}  // namespace FA
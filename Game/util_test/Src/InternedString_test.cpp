@@ -0,0 +1,76 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <functional>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "InternedString.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+TEST(InternedStringTest, EqualStringsShouldShareEntry)
+{
+    InternedString str1("MySheet");
+    InternedString str2(std::string("MySheet"));
+
+    EXPECT_TRUE(str1 == str2);
+    EXPECT_THAT(&str1.Str(), Eq(&str2.Str()));
+}
+
+TEST(InternedStringTest, DifferentStringsShouldDiffer)
+{
+    InternedString str1("MySheet");
+    InternedString str2("MyOtherSheet");
+
+    EXPECT_TRUE(str1 != str2);
+    EXPECT_THAT(str1.Str(), StrEq("MySheet"));
+    EXPECT_THAT(str2.Str(), StrEq("MyOtherSheet"));
+}
+
+TEST(InternedStringTest, DefaultShouldBeEmptyString)
+{
+    InternedString str;
+
+    EXPECT_THAT(str.Str(), IsEmpty());
+    EXPECT_TRUE(str == InternedString(""));
+}
+
+TEST(InternedStringTest, HashShouldBeStringHash)
+{
+    InternedString str("MySheet");
+
+    EXPECT_THAT(str.Hash(), Eq(std::hash<std::string>()("MySheet")));
+    EXPECT_THAT(std::hash<InternedString>()(str), Eq(str.Hash()));
+}
+
+TEST(InternedStringTest, ShouldBeUsableAsKey)
+{
+    std::unordered_map<InternedString, int> map;
+    map[InternedString("MySheet")] = 3;
+
+    EXPECT_THAT(map.at(std::string("MySheet")), Eq(3));
+}
+
+TEST(InternedStringTest, ShouldPrintString)
+{
+    std::ostringstream os;
+    os << InternedString("MySheet");
+
+    EXPECT_THAT(os.str(), StrEq("MySheet"));
+}
+
+}  // namespace Util
+
+}  // namespace FA
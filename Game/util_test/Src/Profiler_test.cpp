@@ -0,0 +1,231 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Profiler.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+class ProfilerTest : public Test
+{
+protected:
+    Profiler profiler_;
+};
+
+TEST_F(ProfilerTest, RegisterSameScopeTwiceShouldReturnSameId)
+{
+    auto id1 = profiler_.RegisterScope("Update");
+    auto id2 = profiler_.RegisterScope("Draw");
+    auto id3 = profiler_.RegisterScope("Update");
+
+    EXPECT_EQ(id1, id3);
+    EXPECT_NE(id1, id2);
+    EXPECT_THAT(profiler_.GetScopeNames(), ElementsAre("Update", "Draw"));
+}
+
+TEST_F(ProfilerTest, RegisterTooManyScopesShouldReturnInvalidScopeId)
+{
+    for (std::size_t i = 0; i < Profiler::maxScopes; i++) {
+        profiler_.RegisterScope("Scope" + std::to_string(i));
+    }
+
+    EXPECT_EQ(profiler_.RegisterScope("OneTooMany"), Profiler::InvalidScopeId);
+}
+
+TEST_F(ProfilerTest, UnknownScopeShouldReturnEmptyStats)
+{
+    auto stats = profiler_.GetStats("Unknown");
+
+    EXPECT_EQ(stats.nFrames_, 0u);
+    EXPECT_THAT(profiler_.GetSamples("Unknown"), IsEmpty());
+}
+
+TEST_F(ProfilerTest, RecordsInSameFrameShouldBeAccumulated)
+{
+    auto id = profiler_.RegisterScope("Update");
+    profiler_.Record(id, std::chrono::milliseconds(2));
+    profiler_.Record(id, std::chrono::milliseconds(3));
+    profiler_.EndFrame();
+
+    EXPECT_THAT(profiler_.GetSamples("Update"), ElementsAre(FloatEq(5.0f)));
+}
+
+TEST_F(ProfilerTest, RecordsShouldNotBeVisibleBeforeEndFrame)
+{
+    auto id = profiler_.RegisterScope("Update");
+    profiler_.Record(id, std::chrono::milliseconds(2));
+
+    EXPECT_THAT(profiler_.GetSamples("Update"), IsEmpty());
+}
+
+TEST_F(ProfilerTest, StatsShouldReturnMinAvgAndP99)
+{
+    auto id = profiler_.RegisterScope("Update");
+    for (int i = 1; i <= 100; i++) {
+        profiler_.Record(id, std::chrono::milliseconds(i));
+        profiler_.EndFrame();
+    }
+
+    auto stats = profiler_.GetStats("Update");
+
+    EXPECT_EQ(stats.nFrames_, 100u);
+    EXPECT_FLOAT_EQ(stats.min_, 1.0f);
+    EXPECT_FLOAT_EQ(stats.avg_, 50.5f);
+    EXPECT_FLOAT_EQ(stats.p99_, 99.0f);
+}
+
+TEST_F(ProfilerTest, HistoryShouldOnlyKeepLatestFrames)
+{
+    auto id = profiler_.RegisterScope("Update");
+    for (std::size_t i = 0; i < 2 * Profiler::nFrames; i++) {
+        profiler_.Record(id, std::chrono::milliseconds(i < Profiler::nFrames ? 100 : 1));
+        profiler_.EndFrame();
+    }
+
+    auto samples = profiler_.GetSamples("Update");
+
+    EXPECT_EQ(samples.size(), Profiler::nFrames - 1);
+    EXPECT_THAT(samples, Each(FloatEq(1.0f)));
+}
+
+TEST_F(ProfilerTest, RecordsFromOtherThreadShouldBeIncluded)
+{
+    auto mainId = profiler_.RegisterScope("Main");
+    auto workerId = profiler_.RegisterScope("Worker");
+    profiler_.Record(mainId, std::chrono::milliseconds(1));
+    profiler_.EndFrame();
+
+    std::thread worker([this, workerId]() {
+        profiler_.Record(workerId, std::chrono::milliseconds(4));
+        profiler_.EndFrame();
+    });
+    worker.join();
+
+    EXPECT_THAT(profiler_.GetSamples("Main"), ElementsAre(FloatEq(1.0f)));
+    EXPECT_THAT(profiler_.GetSamples("Worker"), ElementsAre(FloatEq(4.0f)));
+}
+
+TEST_F(ProfilerTest, TraceShouldContainEventsPerThread)
+{
+    auto id = profiler_.RegisterScope("Load");
+    auto start = Profiler::Clock::now();
+    profiler_.SetThreadName("Main");
+    profiler_.Record(id, start, start + std::chrono::microseconds(5));
+
+    std::thread worker([this, id, start]() {
+        profiler_.Record(id, start + std::chrono::microseconds(1), start + std::chrono::microseconds(3));
+    });
+    worker.join();
+
+    auto trace = profiler_.GetTrace();
+
+    EXPECT_THAT(trace.scopeNames_, ElementsAre("Load"));
+    ASSERT_EQ(trace.threads_.size(), 2u);
+    EXPECT_EQ(trace.threads_[0].id_, 1u);
+    EXPECT_EQ(trace.threads_[0].name_, "Main");
+    ASSERT_EQ(trace.threads_[0].events_.size(), 1u);
+    EXPECT_EQ(trace.threads_[0].events_[0].duration_, 5000);
+    EXPECT_EQ(trace.threads_[1].id_, 2u);
+    ASSERT_EQ(trace.threads_[1].events_.size(), 1u);
+    EXPECT_EQ(trace.threads_[1].events_[0].start_ - trace.threads_[0].events_[0].start_, 1000);
+    EXPECT_EQ(trace.threads_[1].events_[0].duration_, 2000);
+}
+
+TEST_F(ProfilerTest, TraceShouldOnlyKeepLatestEvents)
+{
+    auto id = profiler_.RegisterScope("Update");
+    auto start = Profiler::Clock::now();
+    for (std::size_t i = 0; i < Profiler::maxEvents + 10; i++) {
+        profiler_.Record(id, start, start + std::chrono::nanoseconds(i));
+    }
+
+    auto trace = profiler_.GetTrace();
+
+    ASSERT_EQ(trace.threads_.size(), 1u);
+    ASSERT_EQ(trace.threads_[0].events_.size(), Profiler::maxEvents);
+    EXPECT_EQ(trace.threads_[0].events_.front().duration_, 10);
+}
+
+TEST_F(ProfilerTest, EventsOfExitedThreadsShouldBeKeptUntilTraced)
+{
+    auto id = profiler_.RegisterScope("Load");
+    auto start = Profiler::Clock::now();
+    for (int i = 0; i < 10; i++) {
+        std::thread loader([this, id, start, i]() {
+            profiler_.SetThreadName("Loader");
+            profiler_.Record(id, start, start + std::chrono::nanoseconds(i));
+        });
+        loader.join();
+    }
+
+    auto trace = profiler_.GetTrace();
+
+    ASSERT_EQ(trace.threads_.size(), 10u);
+    for (std::size_t i = 0; i < trace.threads_.size(); i++) {
+        EXPECT_EQ(trace.threads_[i].id_, i + 1);
+        EXPECT_EQ(trace.threads_[i].name_, "Loader");
+        ASSERT_EQ(trace.threads_[i].events_.size(), 1u);
+        EXPECT_EQ(trace.threads_[i].events_[0].duration_, static_cast<std::int64_t>(i));
+    }
+}
+
+TEST_F(ProfilerTest, DataOfExitedThreadShouldBeTakenOverByNewThread)
+{
+    auto id = profiler_.RegisterScope("Load");
+    auto start = Profiler::Clock::now();
+    for (int i = 0; i < 10; i++) {
+        std::thread loader(
+            [this, id, start, i]() { profiler_.Record(id, start, start + std::chrono::nanoseconds(i)); });
+        loader.join();
+    }
+    profiler_.GetTrace();
+
+    auto trace = profiler_.GetTrace();
+
+    ASSERT_EQ(trace.threads_.size(), 1u);
+    EXPECT_EQ(trace.threads_[0].id_, 10u);
+    ASSERT_EQ(trace.threads_[0].events_.size(), 1u);
+    EXPECT_EQ(trace.threads_[0].events_[0].duration_, 9);
+}
+
+TEST_F(ProfilerTest, TraceWhileRecordingShouldOnlyContainWholeEvents)
+{
+    auto id = profiler_.RegisterScope("Update");
+    auto start = Profiler::Clock::now();
+    std::atomic<bool> done{false};
+    // start minus duration is the same for all events, a torn event would differ
+    std::thread worker([this, id, start, &done]() {
+        for (std::size_t i = 0; i < 4 * Profiler::maxEvents; i++) {
+            profiler_.Record(id, start + std::chrono::nanoseconds(i), start + std::chrono::nanoseconds(2 * i));
+        }
+        done = true;
+    });
+
+    do {
+        for (const auto& thread : profiler_.GetTrace().threads_) {
+            if (thread.events_.empty()) continue;
+            auto base = thread.events_.front().start_ - thread.events_.front().duration_;
+            for (const auto& event : thread.events_) {
+                ASSERT_EQ(event.start_ - event.duration_, base);
+            }
+        }
+    } while (!done);
+    worker.join();
+}
+
+}  // namespace Util
+
+}  // namespace FA
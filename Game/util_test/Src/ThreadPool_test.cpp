@@ -0,0 +1,74 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "ThreadPool.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+TEST(ThreadPoolTest, SubmitShouldReturnResult)
+{
+    ThreadPool threadPool(2);
+
+    auto result = threadPool.Submit([]() { return 42; });
+
+    EXPECT_THAT(result.get(), Eq(42));
+}
+
+TEST(ThreadPoolTest, SubmitShouldRunOnWorkerThread)
+{
+    ThreadPool threadPool(1);
+
+    auto id = threadPool.Submit([]() { return std::this_thread::get_id(); });
+
+    EXPECT_THAT(id.get(), Ne(std::this_thread::get_id()));
+}
+
+TEST(ThreadPoolTest, ZeroThreadsShouldGiveOneThread)
+{
+    ThreadPool threadPool(0);
+
+    EXPECT_THAT(threadPool.GetNumberOfThreads(), Eq(1u));
+    EXPECT_THAT(threadPool.Submit([]() { return true; }).get(), IsTrue());
+}
+
+TEST(ThreadPoolTest, DestructorShouldFinishQueuedTasks)
+{
+    std::atomic<int> nCalls{0};
+    {
+        ThreadPool threadPool(2);
+        for (int i = 0; i < 100; i++) {
+            threadPool.Submit([&nCalls]() { nCalls++; });
+        }
+    }
+
+    EXPECT_THAT(nCalls.load(), Eq(100));
+}
+
+TEST(ThreadPoolTest, ExceptionShouldBeThrownFromFuture)
+{
+    ThreadPool threadPool(1);
+
+    auto result = threadPool.Submit([]() -> int { throw std::runtime_error("error"); });
+
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+}  // namespace Util
+
+}  // namespace FA
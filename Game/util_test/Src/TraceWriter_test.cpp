@@ -0,0 +1,83 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <sstream>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "TraceWriter.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace Util {
+
+class TraceWriterTest : public Test
+{
+protected:
+    std::string ToJson(const Profiler::Trace& trace)
+    {
+        std::ostringstream os;
+        TraceWriter::ToJson(trace, os);
+        return os.str();
+    }
+};
+
+TEST_F(TraceWriterTest, EmptyTraceShouldGiveEmptyEventList)
+{
+    Profiler::Trace trace;
+
+    EXPECT_EQ(ToJson(trace), "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[]}\n");
+}
+
+TEST_F(TraceWriterTest, EventsShouldBeCompleteEventsInMicroseconds)
+{
+    Profiler::Trace trace;
+    trace.scopeNames_ = {"Update", "Draw"};
+    trace.threads_.push_back({1, "", {{1, 1500, 2000}}});
+
+    EXPECT_EQ(ToJson(trace), "{\"displayTimeUnit\":\"ms\",\"traceEvents\":["
+                             "{\"name\":\"Draw\",\"ph\":\"X\",\"ts\":1.500,\"dur\":2.000,\"pid\":1,\"tid\":1}]}\n");
+}
+
+TEST_F(TraceWriterTest, NamedThreadShouldGiveThreadNameMetadata)
+{
+    Profiler::Trace trace;
+    trace.scopeNames_ = {"Load"};
+    trace.threads_.push_back({1, "Main", {}});
+    trace.threads_.push_back({2, "Loader", {{0, 0, 1000}}});
+
+    EXPECT_EQ(ToJson(trace), "{\"displayTimeUnit\":\"ms\",\"traceEvents\":["
+                             "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+                             "\"args\":{\"name\":\"Main\"}},\n"
+                             "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,"
+                             "\"args\":{\"name\":\"Loader\"}},\n"
+                             "{\"name\":\"Load\",\"ph\":\"X\",\"ts\":0.000,\"dur\":1.000,\"pid\":1,\"tid\":2}]}\n");
+}
+
+TEST_F(TraceWriterTest, NamesShouldBeEscaped)
+{
+    Profiler::Trace trace;
+    trace.scopeNames_ = {"Say \"hi\""};
+    trace.threads_.push_back({1, "", {{0, 0, 0}}});
+
+    EXPECT_THAT(ToJson(trace), HasSubstr("\"name\":\"Say \\\"hi\\\"\""));
+}
+
+TEST_F(TraceWriterTest, EventWithUnknownScopeShouldBeSkipped)
+{
+    Profiler::Trace trace;
+    trace.scopeNames_ = {"Update"};
+    trace.threads_.push_back({1, "", {{5, 0, 1000}}});
+
+    EXPECT_EQ(ToJson(trace), "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[]}\n");
+}
+
+}  // namespace Util
+
+}  // namespace FA
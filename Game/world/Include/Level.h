@@ -6,24 +6,30 @@
 
 #pragma once
 
+#include <atomic>
+#include <future>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <SFML/System/Vector2.hpp>
+
+#include "BatchRenderTarget.h"
 #include "CameraViews.h"
-#include "RenderTexture.h"
 #include "Resource/SheetManager.h"
+#include "Resource/TextureAtlas.h"
 #include "Resource/TextureManager.h"
 #include "SfmlFwd.h"
-#include "Sprite.h"
 
 namespace FA {
 
 namespace Graphic {
 
 class View;
-class SpriteIf;
+class IndexedTileLayer;
 class RenderTargetIf;
+class VertexArrayIf;
 
 }  // namespace Graphic
 
@@ -43,41 +49,80 @@ namespace Shared {
 
 class MessageBus;
 struct EntityData;
-template <class T>
-class AnimationIf;
-struct ImageFrame;
 
 }  // namespace Shared
 
+namespace Tile {
+
+struct TileMapData;
+
+}  // namespace Tile
+
+namespace Util {
+
+class FileWatcher;
+
+}  // namespace Util
+
 namespace World {
 
 class LevelCreator;
 class TileMap;
+class ChunkedBackground;
+class SpatialIndex;
+class AnimatedTiles;
 
 class Level
 {
+public:
+    // Baked by default. Indexed draws the ground layers with a shader, and falls back to Baked when the map can
+    // not be indexed
+    enum class BackgroundMode { Baked, Indexed };
+
+    // In load order, GetLoadProgress is the share of stages done
+    enum class LoadStage { Parse, Decode, Layers, Entities, Upload, Done };
+
 public:
     Level(Shared::MessageBus& messageBus, Shared::TextureManager& textureManager, const sf::Vector2u& viewSize);
     ~Level();
 
     void Load(const std::string& levelName);
+    void Load(const Tile::TileMapData& tileMapData);
+    // Runs the stages up to Upload on a loader thread. IsLoaded uploads on the calling thread when they are done.
+    void LoadAsync(const std::string& levelName);
+    bool IsLoaded();
+    LoadStage GetLoadStage() const { return loadStage_; }
+    float GetLoadProgress() const;
+    static bool Cook(const std::string& levelName);
     void Update(float deltaTime);
     void Draw(Graphic::RenderTargetIf& renderTarget);
 
+    void SetBackgroundMode(BackgroundMode mode) { backgroundMode_ = mode; }  // before Create
     void Create();
     Graphic::View GetView() const;
+    void AddEntity(const Shared::EntityData& data);
+    // Ground layers only, tileId 0 clears the tile. Changes are applied together on next draw.
+    void SetTile(const std::string& layerName, const sf::Vector2u& cell, int tileId);
+    /* After Create, watches the map and its images. A changed image is written over its sheet in the atlas
+     * on next draw, and only the layers whose tiles changed in the map are rebuilt.
+     */
+    void EnableHotReload();
 
 private:
+    struct TileChange
+    {
+        std::string layerName_;
+        sf::Vector2u cell_;
+        int tileId_{};
+    };
+
     const sf::Vector2u viewSize_;
-    Graphic::RenderTexture backgroundTexture_;
-    Graphic::Sprite backgroundSprite_;
-    std::vector<std::shared_ptr<Graphic::SpriteIf>> fringeLayer_;
-    std::vector<
-        std::tuple<std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>>, std::shared_ptr<Graphic::SpriteIf>>>
-        animationLayer_;
+    Graphic::BatchRenderTarget batchRenderTarget_;
+    std::vector<std::shared_ptr<Graphic::VertexArrayIf>> fringeLayer_;
     Shared::MessageBus& messageBus_;
     Shared::TextureManager& textureManager_;
     Shared::SheetManager sheetManager_;
+    std::unique_ptr<Shared::TextureAtlas> textureAtlas_;
     std::unique_ptr<TileMap> tileMap_;
     Shared::CameraViews cameraViews_;
     std::unique_ptr<Entity::Factory> factory_;
@@ -88,15 +133,35 @@ private:
     std::unique_ptr<Entity::EntityHandler> entityHandler_;
     std::unique_ptr<Entity::ObjIdTranslator> objIdTranslator_;
     std::unique_ptr<LevelCreator> levelCreator_;
+    std::unique_ptr<ChunkedBackground> background_;
+    std::vector<std::unique_ptr<Graphic::IndexedTileLayer>> indexedBackground_;
+    bool isIndexed_{false};  // layers are kept when falling back, the last frames drawn may refer to them
+    BackgroundMode backgroundMode_{BackgroundMode::Baked};
+    std::unique_ptr<SpatialIndex> fringeIndex_;
+    std::unique_ptr<AnimatedTiles> animatedTiles_;
     const float zoomFactor_{0.4f};
+    std::vector<TileChange> tileChanges_;
+    std::string mapPath_;
+    std::unique_ptr<Util::FileWatcher> fileWatcher_;
+    std::unordered_map<std::string, std::string> sheetNames_;  // by image path, of watched images
+    std::vector<std::string> changedSheets_;  // image paths, written to the atlas on next draw
+    std::atomic<LoadStage> loadStage_{LoadStage::Done};
+    std::future<Shared::TextureAtlas::Packed> loading_;  // last, so a running load ends before anything is destroyed
 
 private:
-    void LoadEntitySheets();
-    void LoadTileMap(const std::string& levelName);
+    static void AddEntitySheets(Shared::TextureAtlas& textureAtlas);
+    Shared::TextureAtlas::Packed Prepare(const std::string& levelName);
     void CreateMap();
+    void CreateFringe();
+    void CreateAnimatedTiles();
     void CreateEntities();
     void HandleCreationPool();
     void HandleDeletionPool();
+    void ApplyTileChanges(Graphic::RenderTargetIf& renderTarget);
+    void Reload(const std::vector<std::string> &paths);
+    void ReloadSheets(Graphic::RenderTargetIf& renderTarget);
+    void ReloadMap();
+    sf::FloatRect GetViewRect() const;
 };
 
 }  // namespace World
@@ -0,0 +1,154 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "AnimatedTiles.h"
+
+#include <algorithm>
+
+#include "Profiler.h"
+#include "RenderTargetIf.h"
+#include "TileQuad.h"
+#include "VertexArray.h"
+
+namespace FA {
+
+namespace World {
+
+namespace {
+
+constexpr float cellSize = 128.0f;
+
+}  // namespace
+
+AnimatedTiles::AnimatedTiles(float switchTime)
+    : switchTime_(switchTime)
+    , index_(cellSize)
+{}
+
+AnimatedTiles::~AnimatedTiles() = default;
+
+void AnimatedTiles::Create(const sf::Vector2u &mapSize)
+{
+    animations_.clear();
+    tiles_.clear();
+    visible_.clear();
+    index_.Create(mapSize);
+    dirty_ = true;
+}
+
+void AnimatedTiles::Add(const sf::Vector2f &position, const std::vector<Shared::ImageFrame> &frames)
+{
+    if (frames.empty()) return;
+
+    sf::Vector2i size;
+    for (const auto &frame : frames) {
+        size.x = std::max(size.x, frame.rect_.width);
+        size.y = std::max(size.y, frame.rect_.height);
+    }
+    index_.Add(tiles_.size(), {position, static_cast<sf::Vector2f>(size)});
+    tiles_.push_back({position, AddAnimation(frames)});
+    dirty_ = true;
+}
+
+// Same stepping as Shared::Sequence, at most one frame per update
+void AnimatedTiles::Update(float deltaTime)
+{
+    for (auto &animation : animations_) {
+        animation.time_ += deltaTime;
+        if (animation.time_ >= switchTime_) {
+            animation.time_ = 0.0f;
+            animation.index_ = (animation.index_ + 1) % animation.frames_.size();
+            animation.stepped_ = true;
+        }
+    }
+}
+
+void AnimatedTiles::DrawTo(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &viewRect)
+{
+    auto visible = index_.Query(viewRect);
+    if (visible != visible_) {
+        visible_ = std::move(visible);
+        dirty_ = true;
+    }
+    if (dirty_ || !Refresh()) {
+        Build();
+    }
+    for (auto &animation : animations_) {
+        animation.stepped_ = false;
+    }
+
+    for (std::size_t i = 0; i < nVertexArrays_; i++) {
+        renderTarget.draw(*vertexArrays_[i]);
+    }
+}
+
+std::size_t AnimatedTiles::AddAnimation(const std::vector<Shared::ImageFrame> &frames)
+{
+    auto it = std::find_if(animations_.begin(), animations_.end(),
+                           [&frames](const Animation &animation) { return animation.frames_ == frames; });
+    if (it != animations_.end()) return std::distance(animations_.begin(), it);
+
+    Animation animation;
+    animation.frames_ = frames;
+    animations_.push_back(animation);
+    return animations_.size() - 1;
+}
+
+const Shared::ImageFrame &AnimatedTiles::GetFrame(const Tile &tile) const
+{
+    const auto &animation = animations_[tile.animation_];
+    return animation.frames_[animation.index_];
+}
+
+// Consecutive tiles with the same texture share a vertex array, so the layer order is kept
+void AnimatedTiles::Build()
+{
+    PROFILE_SCOPE("AnimatedTiles::Build");
+    nVertexArrays_ = 0;
+    quads_.clear();
+
+    for (auto i : visible_) {
+        const auto &tile = tiles_[i];
+        const auto &frame = GetFrame(tile);
+        if (frame.texture_ == nullptr) continue;
+
+        if (nVertexArrays_ == 0 || frame.texture_ != textures_[nVertexArrays_ - 1]) {
+            if (nVertexArrays_ == vertexArrays_.size()) {
+                vertexArrays_.push_back(std::make_shared<Graphic::VertexArray>());
+                textures_.push_back(nullptr);
+            }
+            auto &vertexArray = *vertexArrays_[nVertexArrays_];
+            vertexArray.clear();
+            vertexArray.setTexture(*frame.texture_);
+            textures_[nVertexArrays_] = frame.texture_;
+            nVertexArrays_++;
+        }
+        auto &vertexArray = *vertexArrays_[nVertexArrays_ - 1];
+        quads_.push_back({i, nVertexArrays_ - 1, vertexArray.getVertexCount()});
+        AddTileQuad(vertexArray, tile.position_, frame.rect_);
+    }
+
+    dirty_ = false;
+}
+
+// Rewrite quads of stepped animations in place, fails if a frame has moved to another texture
+bool AnimatedTiles::Refresh()
+{
+    for (const auto &quad : quads_) {
+        const auto &tile = tiles_[quad.tile_];
+        if (!animations_[tile.animation_].stepped_) continue;
+
+        const auto &frame = GetFrame(tile);
+        if (frame.texture_ != textures_[quad.vertexArray_]) return false;
+        SetTileQuad(*vertexArrays_[quad.vertexArray_], quad.vertexIndex_, tile.position_, frame.rect_);
+    }
+
+    return true;
+}
+
+}  // namespace World
+
+}  // namespace FA
@@ -0,0 +1,88 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "Resource/ImageFrame.h"
+#include "SpatialIndex.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class RenderTargetIf;
+class TextureIf;
+class VertexArray;
+
+}  // namespace Graphic
+
+namespace World {
+
+/* Looping tile animations sharing one switch time. Tiles with identical frames share one clock, so
+ * updating costs one step per unique animation. Visible tiles are kept in vertex arrays which are
+ * rebuilt when the set of visible tiles changes, otherwise only quads of stepped animations are rewritten.
+ */
+class AnimatedTiles
+{
+public:
+    AnimatedTiles(float switchTime);
+    ~AnimatedTiles();
+
+    void Create(const sf::Vector2u &mapSize);
+    void Add(const sf::Vector2f &position, const std::vector<Shared::ImageFrame> &frames);
+    void Update(float deltaTime);
+    void DrawTo(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &viewRect);
+    std::size_t GetNumberOfAnimations() const { return animations_.size(); }
+
+private:
+    struct Animation
+    {
+        std::vector<Shared::ImageFrame> frames_;
+        float time_{};
+        std::size_t index_{};
+        bool stepped_{false};
+    };
+
+    struct Tile
+    {
+        sf::Vector2f position_;
+        std::size_t animation_{};
+    };
+
+    struct Quad
+    {
+        std::size_t tile_{};
+        std::size_t vertexArray_{};
+        std::size_t vertexIndex_{};
+    };
+
+    const float switchTime_;
+    std::vector<Animation> animations_;
+    std::vector<Tile> tiles_;
+    SpatialIndex index_;
+    std::vector<std::size_t> visible_;
+    bool dirty_{true};
+    std::vector<Quad> quads_;
+    std::vector<std::shared_ptr<Graphic::VertexArray>> vertexArrays_;
+    std::vector<const Graphic::TextureIf *> textures_;
+    std::size_t nVertexArrays_{};
+
+private:
+    std::size_t AddAnimation(const std::vector<Shared::ImageFrame> &frames);
+    const Shared::ImageFrame &GetFrame(const Tile &tile) const;
+    void Build();
+    bool Refresh();
+};
+
+}  // namespace World
+
+}  // namespace FA
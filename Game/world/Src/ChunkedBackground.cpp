@@ -0,0 +1,183 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "ChunkedBackground.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <SFML/Graphics/Color.hpp>
+
+#include "LevelCreator.h"
+#include "Logging.h"
+#include "Profiler.h"
+#include "RectangleShape.h"
+#include "RenderTargetIf.h"
+#include "TexturePass.h"
+#include "View.h"
+
+namespace FA {
+
+namespace World {
+
+namespace {
+
+constexpr float chunkSize = static_cast<float>(backgroundChunkSize);
+constexpr float prefetchMargin = chunkSize / 2.0f;  // build chunks before they become visible
+constexpr float evictMargin = 3.0f * chunkSize / 2.0f;  // larger than prefetch to avoid rebuilding back and forth
+
+sf::FloatRect Grow(const sf::FloatRect &rect, float margin)
+{
+    return {rect.left - margin, rect.top - margin, rect.width + 2.0f * margin, rect.height + 2.0f * margin};
+}
+
+}  // namespace
+
+ChunkedBackground::ChunkedBackground(const LevelCreator &levelCreator)
+    : levelCreator_(levelCreator)
+{}
+
+ChunkedBackground::~ChunkedBackground() = default;
+
+void ChunkedBackground::Create(const sf::Vector2u &mapSize)
+{
+    mapSize_ = mapSize;
+    for (auto &entry : chunks_) {
+        Retire(std::move(entry.second));
+    }
+    chunks_.clear();
+}
+
+void ChunkedBackground::Update(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &viewRect)
+{
+    PROFILE_SCOPE("ChunkedBackground::Update");
+    retired_ = std::move(retiring_);
+    retiring_.clear();
+
+    auto evictRect = Grow(viewRect, evictMargin);
+    for (auto it = chunks_.begin(); it != chunks_.end();) {
+        if (!Intersects(it->first, evictRect)) {
+            Retire(std::move(it->second));
+            it = chunks_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    auto prefetchRect = Grow(viewRect, prefetchMargin);
+    int nCols = static_cast<int>(std::ceil(mapSize_.x / chunkSize));
+    int nRows = static_cast<int>(std::ceil(mapSize_.y / chunkSize));
+    float right = prefetchRect.left + prefetchRect.width;
+    float bottom = prefetchRect.top + prefetchRect.height;
+    int firstCol = std::max(0, static_cast<int>(std::floor(prefetchRect.left / chunkSize)));
+    int lastCol = std::min(nCols - 1, static_cast<int>(std::floor(right / chunkSize)));
+    int firstRow = std::max(0, static_cast<int>(std::floor(prefetchRect.top / chunkSize)));
+    int lastRow = std::min(nRows - 1, static_cast<int>(std::floor(bottom / chunkSize)));
+
+    for (int row = firstRow; row <= lastRow; row++) {
+        for (int col = firstCol; col <= lastCol; col++) {
+            ChunkIndex index{row, col};
+            if (chunks_.find(index) == chunks_.end()) {
+                chunks_[index] = CreateChunk(renderTarget, index);
+            }
+        }
+    }
+}
+
+void ChunkedBackground::DrawTo(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &viewRect) const
+{
+    for (const auto &entry : chunks_) {
+        const auto &chunk = *entry.second;
+        if (chunk.rect_.intersects(viewRect)) renderTarget.draw(chunk.sprite_);
+    }
+}
+
+// Chunks not built yet are left for Update, they are built from the changed tiles anyway
+void ChunkedBackground::Redraw(Graphic::RenderTargetIf &renderTarget, const std::vector<sf::FloatRect> &areas)
+{
+    PROFILE_SCOPE("ChunkedBackground::Redraw");
+    for (auto &entry : chunks_) {
+        auto &chunk = *entry.second;
+        for (const auto &area : areas) {
+            sf::FloatRect chunkArea;
+            if (chunk.rect_.intersects(area, chunkArea)) RedrawArea(renderTarget, chunk, chunkArea);
+        }
+    }
+}
+
+// The texture is created here, it is drawn by the pass
+std::unique_ptr<ChunkedBackground::Chunk> ChunkedBackground::CreateChunk(Graphic::RenderTargetIf &renderTarget,
+                                                                         const ChunkIndex &index) const
+{
+    auto chunk = std::make_unique<Chunk>();
+    chunk->rect_ = GetChunkRect(index);
+    auto width = static_cast<unsigned int>(chunk->rect_.width);
+    auto height = static_cast<unsigned int>(chunk->rect_.height);
+
+    if (!chunk->texture_.create(width, height)) {
+        LOG_ERROR("Could not create background chunk %u x %u", width, height);
+        return chunk;
+    }
+
+    Graphic::View view;
+    view.setSize({chunk->rect_.width, chunk->rect_.height});
+    view.setCenter({chunk->rect_.left + chunk->rect_.width / 2.0f, chunk->rect_.top + chunk->rect_.height / 2.0f});
+    Graphic::TexturePass pass(chunk->texture_, view);
+    pass.clear(sf::Color::Black);
+    levelCreator_.CreateBackground(pass, chunk->rect_);
+    renderTarget.draw(pass);
+    chunk->sprite_.setTexture(chunk->texture_.getTexture(), true);
+    chunk->sprite_.setPosition(chunk->rect_.left, chunk->rect_.top);
+
+    return chunk;
+}
+
+// The viewport clips drawing to the area, the rest of the chunk is kept
+void ChunkedBackground::RedrawArea(Graphic::RenderTargetIf &renderTarget, Chunk &chunk,
+                                   const sf::FloatRect &area) const
+{
+    const auto &rect = chunk.rect_;
+    Graphic::View view;
+    view.setSize({area.width, area.height});
+    view.setCenter({area.left + area.width / 2.0f, area.top + area.height / 2.0f});
+    view.setViewport({(area.left - rect.left) / rect.width, (area.top - rect.top) / rect.height,
+                      area.width / rect.width, area.height / rect.height});
+    Graphic::TexturePass pass(chunk.texture_, view);
+
+    // clear only covers the whole texture
+    Graphic::RectangleShape clearShape;
+    clearShape.setPosition(area.left, area.top);
+    clearShape.setSize({area.width, area.height});
+    clearShape.setFillColor(sf::Color::Black);
+    pass.draw(clearShape);
+    levelCreator_.CreateBackground(pass, area);
+    renderTarget.draw(pass);
+}
+
+void ChunkedBackground::Retire(std::unique_ptr<Chunk> chunk)
+{
+    retiring_.push_back(std::move(chunk));
+}
+
+bool ChunkedBackground::Intersects(const ChunkIndex &index, const sf::FloatRect &rect) const
+{
+    return GetChunkRect(index).intersects(rect);
+}
+
+sf::FloatRect ChunkedBackground::GetChunkRect(const ChunkIndex &index) const
+{
+    float left = index.second * chunkSize;
+    float top = index.first * chunkSize;
+    float width = std::min(chunkSize, mapSize_.x - left);
+    float height = std::min(chunkSize, mapSize_.y - top);
+
+    return {left, top, width, height};
+}
+
+}  // namespace World
+
+}  // namespace FA
@@ -0,0 +1,78 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "RenderTexture.h"
+#include "Sprite.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class RenderTargetIf;
+
+}  // namespace Graphic
+
+namespace World {
+
+class LevelCreator;
+
+constexpr unsigned int backgroundChunkSize = 512;
+
+/* The baked background split into fixed-size textures. Only chunks close to the view are kept,
+ * so memory follows the view size and the map size is not limited by max texture size.
+ * Chunks are built and redrawn by texture passes drawn to the render target, so with a draw list
+ * they are written on the render thread, after the list before has sampled them.
+ */
+class ChunkedBackground
+{
+public:
+    ChunkedBackground(const LevelCreator &levelCreator);
+    ~ChunkedBackground();
+
+    void Create(const sf::Vector2u &mapSize);
+    void Update(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &viewRect);
+    void DrawTo(Graphic::RenderTargetIf &renderTarget, const sf::FloatRect &viewRect) const;
+    void Redraw(Graphic::RenderTargetIf &renderTarget, const std::vector<sf::FloatRect> &areas);
+    std::size_t GetNumberOfChunks() const { return chunks_.size(); }
+
+private:
+    using ChunkIndex = std::pair<int, int>;  // row, column
+
+    struct Chunk
+    {
+        Graphic::RenderTexture texture_;
+        Graphic::Sprite sprite_;
+        sf::FloatRect rect_;
+    };
+
+    const LevelCreator &levelCreator_;
+    sf::Vector2u mapSize_;
+    std::map<ChunkIndex, std::unique_ptr<Chunk>> chunks_;
+    // Dropped chunks may still be sampled by a list the render thread draws, they are freed two updates later
+    std::vector<std::unique_ptr<Chunk>> retiring_;
+    std::vector<std::unique_ptr<Chunk>> retired_;
+
+private:
+    std::unique_ptr<Chunk> CreateChunk(Graphic::RenderTargetIf &renderTarget, const ChunkIndex &index) const;
+    void RedrawArea(Graphic::RenderTargetIf &renderTarget, Chunk &chunk, const sf::FloatRect &area) const;
+    void Retire(std::unique_ptr<Chunk> chunk);
+    bool Intersects(const ChunkIndex &index, const sf::FloatRect &rect) const;
+    sf::FloatRect GetChunkRect(const ChunkIndex &index) const;
+};
+
+}  // namespace World
+
+}  // namespace FA
@@ -8,8 +8,12 @@
 
 #include "Level.h"
 
-#include "Animation/Animation.h"
+#include <algorithm>
+#include <chrono>
+
+#include "AnimatedTiles.h"
 #include "CameraView.h"
+#include "ChunkedBackground.h"
 #include "CollisionHandler.h"
 #include "DrawHandler.h"
 #include "EntityDb.h"
@@ -17,27 +21,75 @@
 #include "EntityIf.h"
 #include "EntityLifeHandler.h"
 #include "Factory.h"
+#include "FileWatcher.h"
 #include "Folder.h"
 #include "Id.h"
+#include "IndexedTileLayer.h"
 #include "LevelCreator.h"
+#include "LevelPackage.h"
 #include "Logging.h"
 #include "ObjIdTranslator.h"
+#include "Profiler.h"
 #include "RenderTargetIf.h"
-#include "Resource/ResourceId.h"
-#include "Resource/SpriteSheet.h"
+#include "Resource/TextureAtlas.h"
 #include "Sheets.h"
+#include "SpatialIndex.h"
 #include "TileMap.h"
+#include "TileMapData.h"
+#include "VertexArrayIf.h"
 #include "View.h"
 
 namespace FA {
 
 namespace World {
 
+namespace {
+
+constexpr float spatialCellSize = 128.0f;
+constexpr float hotReloadInterval = 0.5f;
+const std::vector<std::string> backgroundLayers = {"Ground Layer 1", "Ground Layer 2"};
+const std::string fringeLayer = "Fringe Layer";
+const std::string dynamicLayer = "Dynamic Layer 1";
+
+std::string GetMapPath(const std::string &levelName)
+{
+    return Util::GetAssetsPath() + "/map/" + levelName;
+}
+
+std::string GetEntitySheetPath(const Shared::SheetData &sheetData)
+{
+    return Util::GetAssetsPath() + "/tiny-RPG-forest-files/PNG/" + sheetData.path_;
+}
+
+// The files the level is cooked from, tile sets only reach the package through the map and their images
+std::vector<LevelPackage::Source> GetSources(const std::string &mapPath, const Tile::TileMapData &tileMapData)
+{
+    std::vector<std::string> paths{mapPath};
+    for (const auto &entry : tileMapData.tileSets_) {
+        for (const auto &image : entry.second.images_) {
+            paths.push_back(image.path_);
+        }
+    }
+    for (const auto &sheetData : textureSheets) {
+        paths.push_back(GetEntitySheetPath(sheetData));
+    }
+
+    std::vector<LevelPackage::Source> sources;
+    for (const auto &path : paths) {
+        sources.push_back({path, Util::FileWatcher::GetModifiedTime(path)});
+    }
+
+    return sources;
+}
+
+}  // namespace
+
 Level::Level(Shared::MessageBus &messageBus, Shared::TextureManager &textureManager, const sf::Vector2u &viewSize)
     : messageBus_(messageBus)
     , textureManager_(textureManager)
     , sheetManager_()
-    , tileMap_(std::make_unique<TileMap>(textureManager, sheetManager_))
+    , textureAtlas_(std::make_unique<Shared::TextureAtlas>(textureManager, sheetManager_))
+    , tileMap_(std::make_unique<TileMap>())
     , viewSize_(viewSize)
     , factory_(std::make_unique<Entity::Factory>())
     , entityDb_(std::make_unique<Entity::EntityDb>())
@@ -47,18 +99,85 @@ Level::Level(Shared::MessageBus &messageBus, Shared::TextureManager &textureMana
     , entityHandler_(std::make_unique<Entity::EntityHandler>(*entityDb_))
     , objIdTranslator_(std::make_unique<Entity::ObjIdTranslator>())
     , levelCreator_(std::make_unique<LevelCreator>(textureManager, sheetManager_))
+    , background_(std::make_unique<ChunkedBackground>(*levelCreator_))
+    , fringeIndex_(std::make_unique<SpatialIndex>(spatialCellSize))
+    , animatedTiles_(std::make_unique<AnimatedTiles>(switchTime))
 {}
 
 Level::~Level() = default;
 
 void Level::Load(const std::string &levelName)
 {
-    LoadTileMap(levelName);
-    LoadEntitySheets();
+    PROFILE_SCOPE("Level::Load");
+    mapPath_ = GetMapPath(levelName);
+    auto packed = Prepare(levelName);
+    loadStage_ = LoadStage::Upload;
+    textureAtlas_->Upload(packed);
+    loadStage_ = LoadStage::Done;
+}
+
+void Level::Load(const Tile::TileMapData &tileMapData)
+{
+    tileMap_->Load(tileMapData);
+    tileMap_->AddTileSets(*textureAtlas_);
+    tileMap_->Setup();
+    AddEntitySheets(*textureAtlas_);
+    textureAtlas_->Build();
+}
+
+void Level::LoadAsync(const std::string &levelName)
+{
+    loadStage_ = LoadStage::Parse;
+    mapPath_ = GetMapPath(levelName);
+    // A thread of its own, decoding waits for the worker pool and would block a pool thread
+    loading_ = std::async(std::launch::async, [this, levelName]() {
+        PROFILE_THREAD_NAME("Loader");
+        return Prepare(levelName);
+    });
+}
+
+bool Level::IsLoaded()
+{
+    if (!loading_.valid()) return loadStage_ == LoadStage::Done;
+    if (loading_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+
+    PROFILE_SCOPE("Level::Upload");
+    auto packed = loading_.get();
+    loadStage_ = LoadStage::Upload;
+    textureAtlas_->Upload(packed);
+    loadStage_ = LoadStage::Done;
+
+    return true;
+}
+
+float Level::GetLoadProgress() const
+{
+    return static_cast<float>(loadStage_.load()) / static_cast<float>(LoadStage::Done);
+}
+
+// Parses the map and packs its images like Load does, and stores the result as a package that Load picks up
+bool Level::Cook(const std::string &levelName)
+{
+    auto createFn = []() { return std::make_unique<Graphic::Texture>(); };
+    Shared::TextureManager textureManager(createFn);
+    Shared::SheetManager sheetManager;
+    Shared::TextureAtlas textureAtlas(textureManager, sheetManager);
+    TileMap tileMap;
+    tileMap.Load(GetMapPath(levelName));
+    tileMap.AddTileSets(textureAtlas);
+    AddEntitySheets(textureAtlas);
+
+    LevelPackage package;
+    package.sources_ = GetSources(GetMapPath(levelName), tileMap.GetData());
+    package.tileMapData_ = tileMap.GetData();
+    package.atlas_ = textureAtlas.Pack();
+
+    return WriteLevelPackage(GetLevelPackagePath(levelName), package);
 }
 
 void Level::Create()
 {
+    PROFILE_SCOPE("Level::Create");
     LOG_INFO_ENTER_FUNC();
     CreateMap();
     cameraViews_.CreateCameraView(viewSize_, tileMap_->GetSize(),
@@ -78,69 +197,147 @@ Graphic::View Level::GetView() const
     return view;
 }
 
+void Level::AddEntity(const Shared::EntityData &data)
+{
+    entityLifeHandler_->AddToCreationPool(data);
+}
+
+void Level::SetTile(const std::string &layerName, const sf::Vector2u &cell, int tileId)
+{
+    tileChanges_.push_back({layerName, cell, tileId});
+}
+
+void Level::EnableHotReload()
+{
+    LOG_INFO("Enable hot reload");
+    fileWatcher_ = std::make_unique<Util::FileWatcher>(hotReloadInterval);
+    sheetNames_.clear();
+    if (!mapPath_.empty()) fileWatcher_->Add(mapPath_);
+    // tile set images are named by their path
+    for (const auto &entry : tileMap_->GetData().tileSets_) {
+        for (const auto &image : entry.second.images_) {
+            sheetNames_[image.path_] = image.path_;
+        }
+    }
+    for (const auto &sheetData : textureSheets) {
+        sheetNames_[GetEntitySheetPath(sheetData)] = sheetData.name_;
+    }
+    for (const auto &entry : sheetNames_) {
+        fileWatcher_->Add(entry.first);
+    }
+}
+
 void Level::Update(float deltaTime)
 {
+    PROFILE_SCOPE("Level::Update");
+    if (fileWatcher_) Reload(fileWatcher_->Update(deltaTime));
+
     HandleCreationPool();
-    cameraViews_.Update(deltaTime);
-    for (auto &element : animationLayer_) {
-        auto animation = std::get<0>(element);
-        auto sprite = std::get<1>(element);
-        animation->Update(deltaTime);
-        animation->ApplyTo(*sprite);
+    {
+        PROFILE_SCOPE("Level::Animation");
+        cameraViews_.Update(deltaTime);
+        animatedTiles_->Update(deltaTime);
     }
-
     entityHandler_->Update(deltaTime);
-    collisionHandler_->DetectCollisions();
-    collisionHandler_->DetectOutsideTileMap(tileMap_->GetSize());
-    collisionHandler_->HandleCollisions();
-    collisionHandler_->HandleOutsideTileMap();
+    {
+        PROFILE_SCOPE("Level::Collision");
+        collisionHandler_->DetectCollisions();
+        collisionHandler_->DetectOutsideTileMap(tileMap_->GetSize());
+        collisionHandler_->HandleCollisions();
+        collisionHandler_->HandleOutsideTileMap();
+    }
     HandleDeletionPool();
 }
 
 void Level::Draw(Graphic::RenderTargetIf &renderTarget)
 {
-    renderTarget.draw(backgroundSprite_);
-    drawHandler_->DrawTo(renderTarget);
-    for (const auto &tile : fringeLayer_) {
-        renderTarget.draw(*tile);
+    PROFILE_SCOPE("Level::Draw");
+    auto viewRect = GetViewRect();
+    // texture passes and updates go to renderTarget before any batch that samples the textures
+    ReloadSheets(renderTarget);
+    ApplyTileChanges(renderTarget);
+    if (!isIndexed_) background_->Update(renderTarget, viewRect);
+    batchRenderTarget_.Begin(renderTarget);
+    if (!isIndexed_) {
+        background_->DrawTo(batchRenderTarget_, viewRect);
+    }
+    else {
+        for (const auto &layer : indexedBackground_) {
+            if (layer) batchRenderTarget_.draw(*layer);
+        }
     }
-    for (const auto &element : animationLayer_) {
-        auto sprite = std::get<1>(element);
-        renderTarget.draw(*sprite);
+    drawHandler_->DrawTo(batchRenderTarget_, viewRect);
+    for (auto i : fringeIndex_->Query(viewRect)) {
+        batchRenderTarget_.draw(*fringeLayer_[i]);
     }
+    animatedTiles_->DrawTo(batchRenderTarget_, viewRect);
+    batchRenderTarget_.End();
 }
 
-void Level::LoadEntitySheets()
+void Level::AddEntitySheets(Shared::TextureAtlas &textureAtlas)
 {
-    auto sheetPath = Util::GetAssetsPath() + "/tiny-RPG-forest-files/PNG/";
     for (const auto &sheetData : textureSheets) {
-        auto path = sheetPath + sheetData.path_;
-        Shared::ResourceId id = textureManager_.Load(path);
-        sf::Vector2u textureSize = textureManager_.Get(id)->getSize();
-        auto sheet = std::make_unique<Shared::SpriteSheet>(id, textureSize, sheetData.rectCount_);
-        sheetManager_.AddSheet(sheetData.name_, std::move(sheet));
+        textureAtlas.Add(sheetData.name_, GetEntitySheetPath(sheetData), sheetData.rectCount_);
     }
 }
 
-void Level::LoadTileMap(const std::string &levelName)
+// All stages but Upload, nothing here may touch the GPU or anything the owning thread uses while loading
+Shared::TextureAtlas::Packed Level::Prepare(const std::string &levelName)
 {
-    auto path = Util::GetAssetsPath() + "/map/" + levelName;
-    tileMap_->Load(path);
-    tileMap_->Setup();
+    PROFILE_SCOPE("Level::Prepare");
+    Shared::TextureAtlas::Packed packed;
+    LevelPackage package;
+    loadStage_ = LoadStage::Parse;
+    if (ReadLevelPackage(GetLevelPackagePath(levelName), package)) {
+        LOG_INFO("Load cooked package for %s", DUMP(levelName));
+        tileMap_->Load(package.tileMapData_);
+        packed = std::move(package.atlas_);  // pages are decoded and packed already
+    }
+    else {
+        tileMap_->Load(GetMapPath(levelName));
+        loadStage_ = LoadStage::Decode;
+        tileMap_->AddTileSets(*textureAtlas_);
+        AddEntitySheets(*textureAtlas_);
+        packed = textureAtlas_->Pack();
+    }
+    loadStage_ = LoadStage::Layers;
+    tileMap_->SetupLayers();
+    loadStage_ = LoadStage::Entities;
+    tileMap_->SetupEntityGroups();
+
+    return packed;
 }
 
 void Level::CreateMap()
 {
     LOG_INFO("Create map");
-    levelCreator_->AddBackground(tileMap_->GetLayer("Ground Layer 1"));
-    levelCreator_->AddBackground(tileMap_->GetLayer("Ground Layer 2"));
-    auto size = tileMap_->GetSize();
-    backgroundTexture_.create(size.x, size.y);
-    levelCreator_->CreateBackground(backgroundTexture_);
-    backgroundTexture_.display();
-    backgroundSprite_.setTexture(backgroundTexture_.getTexture());
-    fringeLayer_ = levelCreator_->CreateFringe(tileMap_->GetLayer("Fringe Layer"));
-    animationLayer_ = levelCreator_->CreateAnimations(tileMap_->GetLayer("Dynamic Layer 1"));
+    for (const auto &layerName : backgroundLayers) {
+        levelCreator_->AddBackground(tileMap_->GetLayer(layerName), tileMap_->GetTileSize());
+    }
+    if (backgroundMode_ == BackgroundMode::Indexed) {
+        indexedBackground_ = levelCreator_->CreateIndexedBackground(tileMap_->GetSize(), tileMap_->GetTileSize());
+        isIndexed_ = !indexedBackground_.empty();
+        if (!isIndexed_) LOG_WARN("Can not index background, bake it instead");
+    }
+    background_->Create(tileMap_->GetSize());
+    CreateFringe();
+    CreateAnimatedTiles();
+}
+
+void Level::CreateFringe()
+{
+    fringeLayer_ = levelCreator_->CreateFringe(tileMap_->GetLayer(fringeLayer));
+    fringeIndex_->Create(tileMap_->GetSize());
+    for (std::size_t i = 0; i < fringeLayer_.size(); i++) {
+        fringeIndex_->Add(i, fringeLayer_[i]->getBounds());
+    }
+}
+
+void Level::CreateAnimatedTiles()
+{
+    animatedTiles_->Create(tileMap_->GetSize());
+    levelCreator_->CreateAnimatedTiles(tileMap_->GetLayer(dynamicLayer), *animatedTiles_);
+    LOG_INFO("%zu unique tile animations", animatedTiles_->GetNumberOfAnimations());
 }
 
 void Level::CreateEntities()
@@ -157,6 +354,7 @@ void Level::CreateEntities()
 
 void Level::HandleCreationPool()
 {
+    PROFILE_SCOPE("Level::CreationPool");
     auto creationPool = entityLifeHandler_->MoveCreationPool();
     for (const auto &data : creationPool) {
         auto id = entityHandler_->AddEntity(data, *factory_, messageBus_, textureManager_, sheetManager_, cameraViews_,
@@ -169,6 +367,7 @@ void Level::HandleCreationPool()
 
 void Level::HandleDeletionPool()
 {
+    PROFILE_SCOPE("Level::DeletionPool");
     auto deletionPool = entityLifeHandler_->MoveDeletionPool();
     for (const auto &id : deletionPool) {
         objIdTranslator_->Remove(id);
@@ -178,6 +377,112 @@ void Level::HandleDeletionPool()
     }
 }
 
+// All changes of a frame go in one pass, each index texture is uploaded once and each chunk displayed once
+void Level::ApplyTileChanges(Graphic::RenderTargetIf &renderTarget)
+{
+    if (tileChanges_.empty()) return;
+
+    PROFILE_SCOPE("Level::TileChanges");
+    std::vector<sf::FloatRect> areas;
+    for (const auto &change : tileChanges_) {
+        auto it = std::find(backgroundLayers.begin(), backgroundLayers.end(), change.layerName_);
+        if (it == backgroundLayers.end() || !tileMap_->SetTile(change.layerName_, change.cell_, change.tileId_)) {
+            LOG_WARN("Can not set tile %d in %s", change.tileId_, DUMP(change.layerName_));
+            continue;
+        }
+
+        auto layerIndex = static_cast<std::size_t>(std::distance(backgroundLayers.begin(), it));
+        const auto *data = tileMap_->GetTile(change.layerName_, change.cell_);
+        areas.push_back(levelCreator_->SetBackgroundTile(layerIndex, change.cell_, data));
+        if (isIndexed_ && !levelCreator_->SetIndexedTile(indexedBackground_[layerIndex].get(), change.cell_, data)) {
+            LOG_WARN("Can not index tile %d, bake background instead", change.tileId_);
+            isIndexed_ = false;
+        }
+    }
+    tileChanges_.clear();
+
+    if (isIndexed_) {
+        for (const auto &layer : indexedBackground_) {
+            if (layer) layer->update();
+        }
+    }
+    background_->Redraw(renderTarget, areas);
+}
+
+void Level::Reload(const std::vector<std::string> &paths)
+{
+    for (const auto &path : paths) {
+        LOG_INFO("%s changed", DUMP(path));
+        if (path == mapPath_) {
+            ReloadMap();
+            continue;
+        }
+        if (sheetNames_.find(path) != sheetNames_.end()) changedSheets_.push_back(path);
+    }
+}
+
+// Atlas pages are written when renderTarget is drawn, so not while the frame before may sample them
+void Level::ReloadSheets(Graphic::RenderTargetIf &renderTarget)
+{
+    if (changedSheets_.empty()) return;
+
+    PROFILE_SCOPE("Level::ReloadSheets");
+    bool isTileSetReloaded = false;
+    for (const auto &path : changedSheets_) {
+        const auto &name = sheetNames_.at(path);
+        bool isTileSet = name == path;  // tile set images are named by their path
+        if (textureAtlas_->Reload(name, path, renderTarget) && isTileSet) isTileSetReloaded = true;
+    }
+    changedSheets_.clear();
+
+    // baked chunks keep the old tiles, they are built again from the page by the next background update
+    if (isTileSetReloaded && !isIndexed_) background_->Create(tileMap_->GetSize());
+}
+
+/* Ground layer tiles that differ go through the same path as SetTile, so only their chunks are redrawn.
+ * The fringe and the animated tiles are created again when their layer differs, the rest is kept.
+ */
+void Level::ReloadMap()
+{
+    PROFILE_SCOPE("Level::ReloadMap");
+    auto loaded = tileMap_->GetData().layers_;
+    std::vector<std::string> changedLayers;
+    if (!tileMap_->Reload(mapPath_, changedLayers)) {
+        LOG_WARN("More than the tiles of %s changed, load the level again to see it", DUMP(mapPath_));
+        return;
+    }
+
+    const auto &layers = tileMap_->GetData().layers_;
+    auto nCols = tileMap_->GetData().mapProperties_.width_;
+    for (std::size_t i = 0; i < layers.size(); i++) {
+        const auto &layer = layers[i];
+        if (std::find(changedLayers.begin(), changedLayers.end(), layer.name_) == changedLayers.end()) continue;
+
+        LOG_INFO("Rebuild %s", DUMP(layer.name_));
+        if (std::find(backgroundLayers.begin(), backgroundLayers.end(), layer.name_) != backgroundLayers.end()) {
+            for (std::size_t inx = 0; inx < layer.tileIds_.size(); inx++) {
+                if (layer.tileIds_[inx] == loaded[i].tileIds_[inx]) continue;
+                sf::Vector2u cell(static_cast<unsigned int>(inx % nCols), static_cast<unsigned int>(inx / nCols));
+                SetTile(layer.name_, cell, layer.tileIds_[inx]);
+            }
+        }
+        else if (layer.name_ == fringeLayer) {
+            CreateFringe();
+        }
+        else if (layer.name_ == dynamicLayer) {
+            CreateAnimatedTiles();
+        }
+    }
+}
+
+sf::FloatRect Level::GetViewRect() const
+{
+    auto size = static_cast<sf::Vector2f>(viewSize_) * zoomFactor_;
+    auto center = cameraViews_.GetCameraView().GetPosition();
+
+    return {center - size / 2.0f, size};
+}
+
 }  // namespace World
 
 }  // namespace FA
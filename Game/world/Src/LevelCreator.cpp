@@ -8,98 +8,283 @@
 
 #include "LevelCreator.h"
 
-#include "Animation/Animation.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+
+#include "AnimatedTiles.h"
+#include "IndexedTileLayer.h"
 #include "RenderTargetIf.h"
 #include "Resource/ImageFrame.h"
 #include "Resource/SheetManager.h"
 #include "Resource/TextureRect.h"
-#include "Sequence.h"
 #include "Sprite.h"
+#include "TileQuad.h"
+#include "VertexArray.h"
 
 namespace FA {
 
 namespace World {
 
+namespace {
+
+sf::FloatRect Merge(const sf::FloatRect &lhs, const sf::FloatRect &rhs)
+{
+    if (lhs.width <= 0.0f || lhs.height <= 0.0f) return rhs;
+
+    auto left = std::min(lhs.left, rhs.left);
+    auto top = std::min(lhs.top, rhs.top);
+    auto right = std::max(lhs.left + lhs.width, rhs.left + rhs.width);
+    auto bottom = std::max(lhs.top + lhs.height, rhs.top + rhs.height);
+
+    return {left, top, right - left, bottom - top};
+}
+
+// Tiles in a layer are kept in the order they are drawn, row by row
+template <class Layer>
+auto FindTile(Layer &layer, const sf::Vector2u &cell) -> decltype(layer.begin())
+{
+    return std::lower_bound(layer.begin(), layer.end(), cell, [](const TileMap::TileData &data, const sf::Vector2u &c) {
+        return std::tie(data.cell_.y, data.cell_.x) < std::tie(c.y, c.x);
+    });
+}
+
+}  // namespace
+
 LevelCreator::LevelCreator(const Shared::TextureManager &textureManager, const Shared::SheetManager &sheetManager)
     : textureManager_(textureManager)
     , sheetManager_(sheetManager)
 {}
 
-void LevelCreator::AddBackground(const std::vector<TileMap::TileData> &layer)
+void LevelCreator::AddBackground(const std::vector<TileMap::TileData> &layer, const sf::Vector2u &tileSize)
 {
-    layers_.push_back(layer);
+    tileSize_ = tileSize;
+    Background background;
+    background.tiles_ = layer;
+    for (const auto &data : layer) {
+        Grow(background, data);
+    }
+    layers_.push_back(std::move(background));
 }
 
-void LevelCreator::CreateBackground(Graphic::RenderTargetIf &texture) const
+// Only the rows and columns of tiles that can reach into the area are visited, not the whole layer
+void LevelCreator::CreateBackground(Graphic::RenderTargetIf &texture, const sf::FloatRect &area) const
 {
+    // one sprite for all tiles, the texture is only looked up again when it changes
+    Graphic::Sprite sprite;
     for (const auto &layer : layers_) {
-        for (const auto &data : layer) {
-            auto sprite = CreateSprite(data);
-            texture.draw(*sprite);
+        auto range = GetCellRange(layer, area);
+        for (int row = range.top; row < range.top + range.height; row++) {
+            sf::Vector2u first(static_cast<unsigned int>(range.left), static_cast<unsigned int>(row));
+            auto end = static_cast<unsigned int>(range.left + range.width);
+            for (auto it = FindTile(layer.tiles_, first);
+                 it != layer.tiles_.end() && it->cell_.y == first.y && it->cell_.x < end; ++it) {
+                if (!GetBounds(*it).intersects(area)) continue;
+                SetupSprite(sprite, *it);
+                texture.draw(sprite);
+            }
         }
     }
 }
 
-std::vector<std::shared_ptr<Graphic::SpriteIf>> LevelCreator::CreateFringe(
+// One index texture per layer, nothing is returned when a layer can not be indexed. An empty layer
+// has no texture to index into and gets no index texture.
+std::vector<std::unique_ptr<Graphic::IndexedTileLayer>> LevelCreator::CreateIndexedBackground(
+    const sf::Vector2u &mapSize, const sf::Vector2u &tileSize) const
+{
+    std::vector<std::unique_ptr<Graphic::IndexedTileLayer>> indexedLayers;
+    if (!Graphic::IndexedTileLayer::isAvailable() || tileSize.x == 0 || tileSize.y == 0) return {};
+
+    sf::Vector2u gridSize(mapSize.x / tileSize.x, mapSize.y / tileSize.y);
+    for (const auto &layer : layers_) {
+        const Graphic::TextureIf *layerTexture = nullptr;
+        std::vector<std::pair<sf::Vector2u, sf::Vector2u>> tiles;  // grid cell, position in texture
+        for (const auto &data : layer.tiles_) {
+            sf::Vector2u position;
+            const auto *texture = GetIndexedTile(data, tileSize, position);
+            if (texture == nullptr || (layerTexture != nullptr && texture != layerTexture)) return {};
+            layerTexture = texture;
+            tiles.push_back({data.cell_, position});
+        }
+
+        std::unique_ptr<Graphic::IndexedTileLayer> indexedLayer;
+        if (layerTexture != nullptr) {
+            indexedLayer = std::make_unique<Graphic::IndexedTileLayer>();
+            if (!indexedLayer->create(gridSize, tileSize, *layerTexture)) return {};
+            for (const auto &tile : tiles) {
+                indexedLayer->setTile(tile.first, tile.second);
+            }
+            indexedLayer->update();
+        }
+        indexedLayers.push_back(std::move(indexedLayer));
+    }
+
+    return indexedLayers;
+}
+
+// Replaces the tile in a cell of a background layer, data is nullptr to clear it. Returns the area to redraw.
+sf::FloatRect LevelCreator::SetBackgroundTile(std::size_t layerIndex, const sf::Vector2u &cell,
+                                              const TileMap::TileData *data)
+{
+    auto &background = layers_.at(layerIndex);
+    auto &layer = background.tiles_;
+    auto it = FindTile(layer, cell);
+    sf::FloatRect area;
+    if (it != layer.end() && it->cell_ == cell) {
+        area = GetBounds(*it);
+        if (data != nullptr) {
+            *it = *data;
+        }
+        else {
+            layer.erase(it);
+        }
+    }
+    else if (data != nullptr) {
+        layer.insert(it, *data);
+    }
+    if (data != nullptr) {
+        area = Merge(area, GetBounds(*data));
+        Grow(background, *data);
+    }
+
+    return area;
+}
+
+// Returns false if the tile does not fit the index texture, data is nullptr to clear the cell
+bool LevelCreator::SetIndexedTile(Graphic::IndexedTileLayer *indexedLayer, const sf::Vector2u &cell,
+                                  const TileMap::TileData *data) const
+{
+    if (data == nullptr) {
+        if (indexedLayer != nullptr) indexedLayer->clearTile(cell);
+        return true;
+    }
+    if (indexedLayer == nullptr) return false;
+
+    sf::Vector2u position;
+    const auto *texture = GetIndexedTile(*data, indexedLayer->getTileSize(), position);
+    if (texture == nullptr || texture != indexedLayer->getTileset()) return false;
+
+    indexedLayer->setTile(cell, position);
+    return true;
+}
+
+// Tiles are baked into one vertex array per texture and chunk. A new set of chunks is started each time
+// the texture changes, so tiles from different textures are still drawn in layer order.
+std::vector<std::shared_ptr<Graphic::VertexArrayIf>> LevelCreator::CreateFringe(
     const std::vector<TileMap::TileData> &layer) const
 {
-    std::vector<std::shared_ptr<Graphic::SpriteIf>> fringe;
+    std::vector<std::shared_ptr<Graphic::VertexArrayIf>> fringe;
+    std::map<std::pair<int, int>, std::shared_ptr<Graphic::VertexArrayIf>> chunks;
+    const Graphic::TextureIf *chunksTexture = nullptr;
 
     for (const auto &data : layer) {
-        auto sprite = CreateSprite(data);
-        fringe.push_back(sprite);
+        auto textureRect = sheetManager_.GetTextureRect(data.graphic_.image_.sheetItem_);
+        const auto *texture = textureManager_.Get(textureRect.id_);
+        if (texture == nullptr) continue;
+
+        if (texture != chunksTexture) {
+            chunks.clear();
+            chunksTexture = texture;
+        }
+
+        auto key = std::make_pair(static_cast<int>(std::floor(data.position_.y / fringeChunkSize)),
+                                  static_cast<int>(std::floor(data.position_.x / fringeChunkSize)));
+        auto &chunk = chunks[key];
+        if (!chunk) {
+            chunk = std::make_shared<Graphic::VertexArray>();
+            chunk->setTexture(*texture);
+            fringe.push_back(chunk);
+        }
+        AddTileQuad(*chunk, data.position_, textureRect.rect_);
     }
 
     return fringe;
 }
 
-std::vector<std::tuple<std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>>, std::shared_ptr<Graphic::SpriteIf>>>
-LevelCreator::CreateAnimations(const std::vector<TileMap::TileData> &layer) const
+void LevelCreator::CreateAnimatedTiles(const std::vector<TileMap::TileData> &layer,
+                                       AnimatedTiles &animatedTiles) const
 {
-    std::vector<
-        std::tuple<std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>>, std::shared_ptr<Graphic::SpriteIf>>>
-        animations;
-
     for (const auto &data : layer) {
-        auto animation = CreateAnimation(data);
-        auto sprite = std::make_shared<Graphic::Sprite>();
-        sprite->setPosition(data.position_);
-        animations.push_back({animation, sprite});
+        std::vector<Shared::ImageFrame> frames;
+        for (const auto &image : data.graphic_.animation_) {
+            auto textureRect = sheetManager_.GetTextureRect(image.sheetItem_);
+            const auto *texture = textureManager_.Get(textureRect.id_);
+            frames.push_back({texture, textureRect.rect_, {}});
+        }
+        animatedTiles.Add(data.position_, frames);
     }
+}
 
-    return animations;
+// For animated tiles the bounds cover the largest frame
+sf::FloatRect LevelCreator::GetBounds(const TileMap::TileData &data) const
+{
+    sf::Vector2i size;
+    auto grow = [this, &size](const Shared::SheetItem &item) {
+        auto rect = sheetManager_.GetTextureRect(item).rect_;
+        size.x = std::max(size.x, rect.width);
+        size.y = std::max(size.y, rect.height);
+    };
+
+    if (data.graphic_.animation_.empty()) {
+        grow(data.graphic_.image_.sheetItem_);
+    }
+    else {
+        for (const auto &image : data.graphic_.animation_) {
+            grow(image.sheetItem_);
+        }
+    }
+
+    return {data.position_, static_cast<sf::Vector2f>(size)};
 }
 
-std::shared_ptr<Graphic::SpriteIf> LevelCreator::CreateSprite(const TileMap::TileData &data) const
+// A tile can be indexed when it is not animated and exactly one grid cell in size
+const Graphic::TextureIf *LevelCreator::GetIndexedTile(const TileMap::TileData &data, const sf::Vector2u &tileSize,
+                                                       sf::Vector2u &position) const
 {
-    auto imageData = data.graphic_.image_;
-    auto textureRect = sheetManager_.GetTextureRect(imageData.sheetItem_);
-    const auto *texture = textureManager_.Get(textureRect.id_);
-    auto sprite = std::make_shared<Graphic::Sprite>();
-    sprite->setTexture(*texture);
-    sprite->setTextureRect(textureRect.rect_);
-    sprite->setPosition(data.position_);
+    if (!data.graphic_.animation_.empty()) return nullptr;
 
-    return sprite;
+    auto textureRect = sheetManager_.GetTextureRect(data.graphic_.image_.sheetItem_);
+    const auto &rect = textureRect.rect_;
+    if (rect.width != static_cast<int>(tileSize.x) || rect.height != static_cast<int>(tileSize.y)) return nullptr;
+
+    position = sf::Vector2u(rect.left, rect.top);
+    return textureManager_.Get(textureRect.id_);
 }
 
-std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>> LevelCreator::CreateAnimation(
-    const TileMap::TileData &data) const
+/* Columns are left aligned with the tile position. Rows are not, tall animated tiles are moved up to stand on
+ * their cell, so the largest tile size is added both above and below the area.
+ */
+sf::IntRect LevelCreator::GetCellRange(const Background &layer, const sf::FloatRect &area) const
 {
-    float t = switchTime;
-    auto seq = std::make_shared<Shared::Sequence<Shared::ImageFrame>>(t);
-    for (const auto &image : data.graphic_.animation_) {
-        auto textureRect = sheetManager_.GetTextureRect(image.sheetItem_);
-        auto textureSize = sf::Vector2i(textureRect.rect_.width, textureRect.rect_.height);
-        const auto *texture = textureManager_.Get(textureRect.id_);
-        sf::Vector2i center = textureSize / 2;
-        seq->Add({texture, textureRect.rect_, static_cast<sf::Vector2f>(center)});
-    }
+    if (tileSize_.x == 0 || tileSize_.y == 0) return {};
 
-    auto animation = std::make_shared<Shared::Animation<Shared::ImageFrame>>(seq, false);
-    animation->Start();
+    auto tileWidth = static_cast<float>(tileSize_.x);
+    auto tileHeight = static_cast<float>(tileSize_.y);
+    const auto &maxSize = layer.maxTileSize_;
+    int firstCol = std::max(0, static_cast<int>(std::floor((area.left - maxSize.x) / tileWidth)));
+    int endCol = static_cast<int>(std::ceil((area.left + area.width) / tileWidth));
+    int firstRow = std::max(0, static_cast<int>(std::floor((area.top - maxSize.y) / tileHeight)));
+    int endRow = static_cast<int>(std::ceil((area.top + area.height + maxSize.y) / tileHeight));
 
-    return animation;
+    return {firstCol, firstRow, std::max(0, endCol - firstCol), std::max(0, endRow - firstRow)};
+}
+
+void LevelCreator::Grow(Background &layer, const TileMap::TileData &data) const
+{
+    auto bounds = GetBounds(data);
+    layer.maxTileSize_.x = std::max(layer.maxTileSize_.x, bounds.width);
+    layer.maxTileSize_.y = std::max(layer.maxTileSize_.y, bounds.height);
+}
+
+void LevelCreator::SetupSprite(Graphic::Sprite &sprite, const TileMap::TileData &data) const
+{
+    const auto &imageData = data.graphic_.image_;
+    auto textureRect = sheetManager_.GetTextureRect(imageData.sheetItem_);
+    const auto *texture = textureManager_.Get(textureRect.id_);
+    sprite.setTexture(*texture);
+    sprite.setTextureRect(textureRect.rect_);
+    sprite.setPosition(data.position_);
 }
 
 }  // namespace World
@@ -7,9 +7,10 @@
 #pragma once
 
 #include <memory>
-#include <tuple>
 #include <vector>
 
+#include <SFML/Graphics/Rect.hpp>
+
 #include "Resource/TextureManager.h"
 #include "TileMap.h"
 
@@ -17,44 +18,62 @@ namespace FA {
 
 namespace Graphic {
 
+class IndexedTileLayer;
 class RenderTargetIf;
-class SpriteIf;
+class Sprite;
+class TextureIf;
+class VertexArrayIf;
 
 }  // namespace Graphic
 
 namespace Shared {
 
 class SheetManager;
-template <class T>
-class AnimationIf;
-struct ImageFrame;
 
 }  // namespace Shared
 
 namespace World {
 
+class AnimatedTiles;
+
 constexpr float switchTime = 0.1f;
+constexpr float fringeChunkSize = 512.0f;
 
 class LevelCreator
 {
 public:
     LevelCreator(const Shared::TextureManager &textureManager, const Shared::SheetManager &sheetManager);
 
-    void AddBackground(const std::vector<TileMap::TileData> &layer);
-    void CreateBackground(Graphic::RenderTargetIf &texture) const;
-    std::vector<std::shared_ptr<Graphic::SpriteIf>> CreateFringe(const std::vector<TileMap::TileData> &layer) const;
-    std::vector<
-        std::tuple<std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>>, std::shared_ptr<Graphic::SpriteIf>>>
-    CreateAnimations(const std::vector<TileMap::TileData> &layer) const;
+    void AddBackground(const std::vector<TileMap::TileData> &layer, const sf::Vector2u &tileSize);
+    void CreateBackground(Graphic::RenderTargetIf &texture, const sf::FloatRect &area) const;
+    std::vector<std::unique_ptr<Graphic::IndexedTileLayer>> CreateIndexedBackground(
+        const sf::Vector2u &mapSize, const sf::Vector2u &tileSize) const;
+    sf::FloatRect SetBackgroundTile(std::size_t layerIndex, const sf::Vector2u &cell, const TileMap::TileData *data);
+    bool SetIndexedTile(Graphic::IndexedTileLayer *indexedLayer, const sf::Vector2u &cell,
+                        const TileMap::TileData *data) const;
+    std::vector<std::shared_ptr<Graphic::VertexArrayIf>> CreateFringe(
+        const std::vector<TileMap::TileData> &layer) const;
+    void CreateAnimatedTiles(const std::vector<TileMap::TileData> &layer, AnimatedTiles &animatedTiles) const;
+    sf::FloatRect GetBounds(const TileMap::TileData &data) const;
 
 private:
+    struct Background
+    {
+        std::vector<TileMap::TileData> tiles_;
+        sf::Vector2f maxTileSize_;  // largest bounds of any tile, tiles can reach this far out of their cell
+    };
+
     const Shared::TextureManager &textureManager_;
     const Shared::SheetManager &sheetManager_;
-    std::vector<std::vector<TileMap::TileData>> layers_;
+    std::vector<Background> layers_;
+    sf::Vector2u tileSize_;
 
 private:
-    std::shared_ptr<Graphic::SpriteIf> CreateSprite(const TileMap::TileData &data) const;
-    std::shared_ptr<Shared::AnimationIf<Shared::ImageFrame>> CreateAnimation(const TileMap::TileData &data) const;
+    sf::IntRect GetCellRange(const Background &layer, const sf::FloatRect &area) const;
+    void Grow(Background &layer, const TileMap::TileData &data) const;
+    const Graphic::TextureIf *GetIndexedTile(const TileMap::TileData &data, const sf::Vector2u &tileSize,
+                                             sf::Vector2u &position) const;
+    void SetupSprite(Graphic::Sprite &sprite, const TileMap::TileData &data) const;
 };
 
 }  // namespace World
@@ -0,0 +1,157 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "LevelPackage.h"
+
+#include <fstream>
+
+#include "BinaryStream.h"
+#include "FileWatcher.h"
+#include "Folder.h"
+#include "Image.h"
+#include "Logging.h"
+#include "Profiler.h"
+#include "TileMapBinary.h"
+
+namespace FA {
+
+namespace World {
+
+namespace {
+
+constexpr std::uint32_t magic = 0x4b504146;  // "FAPK"
+constexpr std::uint32_t version = 2;
+
+void WriteVector2u(Util::BinaryWriter &writer, const sf::Vector2u &v)
+{
+    writer.Write(static_cast<std::uint32_t>(v.x));
+    writer.Write(static_cast<std::uint32_t>(v.y));
+}
+
+sf::Vector2u ReadVector2u(Util::BinaryReader &reader)
+{
+    auto x = reader.ReadUInt32();
+    auto y = reader.ReadUInt32();
+    return {x, y};
+}
+
+void WriteTime(Util::BinaryWriter &writer, std::time_t time)
+{
+    auto value = static_cast<std::uint64_t>(time);
+    writer.Write(static_cast<std::uint32_t>(value & 0xffffffff));
+    writer.Write(static_cast<std::uint32_t>(value >> 32));
+}
+
+std::time_t ReadTime(Util::BinaryReader &reader)
+{
+    std::uint64_t low = reader.ReadUInt32();
+    std::uint64_t high = reader.ReadUInt32();
+    return static_cast<std::time_t>(low | (high << 32));
+}
+
+}  // namespace
+
+std::string GetLevelPackagePath(const std::string &levelName)
+{
+    auto name = levelName.substr(0, levelName.find_last_of('.'));
+    return Util::GetAssetsPath() + "/map/" + name + ".pkg";
+}
+
+bool WriteLevelPackage(const std::string &path, const LevelPackage &package)
+{
+    std::ofstream os(path, std::ios::binary);
+    Util::BinaryWriter writer(os);
+    writer.Write(magic);
+    writer.Write(version);
+    writer.Write(static_cast<std::uint32_t>(package.sources_.size()));
+    for (const auto &source : package.sources_) {
+        writer.Write(source.path_);
+        WriteTime(writer, source.modified_);
+    }
+    Tile::WriteTileMapData(writer, package.tileMapData_);
+
+    const auto &atlas = package.atlas_;
+    writer.Write(static_cast<std::uint32_t>(atlas.sheets_.size()));
+    for (const auto &sheet : atlas.sheets_) {
+        writer.Write(sheet.name_);
+        writer.Write(static_cast<std::uint32_t>(sheet.page_));
+        WriteVector2u(writer, sheet.position_);
+        WriteVector2u(writer, sheet.size_);
+        WriteVector2u(writer, sheet.rectCount_);
+    }
+    // raw RGBA, uploading needs no decoding
+    writer.Write(static_cast<std::uint32_t>(atlas.pages_.size()));
+    for (const auto &page : atlas.pages_) {
+        auto size = page->getSize();
+        WriteVector2u(writer, size);
+        writer.Write(page->getPixelsPtr(), 4 * size.x * size.y);
+    }
+
+    if (!writer.IsGood()) {
+        LOG_ERROR("Could not write %s", DUMP(path));
+        return false;
+    }
+
+    return true;
+}
+
+bool ReadLevelPackage(const std::string &path, LevelPackage &package)
+{
+    PROFILE_SCOPE("ReadLevelPackage");
+    std::ifstream is(path, std::ios::binary);
+    if (!is) return false;
+
+    Util::BinaryReader reader(is);
+    if (reader.ReadUInt32() != magic || reader.ReadUInt32() != version) {
+        LOG_WARN("%s has unknown format or version", DUMP(path));
+        return false;
+    }
+    // checked before the rest is read, a stale package is not worth reading
+    auto nSources = reader.ReadUInt32();
+    for (std::uint32_t i = 0; i < nSources && reader.IsGood(); i++) {
+        LevelPackage::Source source;
+        source.path_ = reader.ReadString();
+        source.modified_ = ReadTime(reader);
+        if (reader.IsGood() && Util::FileWatcher::GetModifiedTime(source.path_) != source.modified_) {
+            LOG_WARN("%s is older than %s, cook it again", DUMP(path), DUMP(source.path_));
+            return false;
+        }
+        package.sources_.push_back(source);
+    }
+    Tile::ReadTileMapData(reader, package.tileMapData_);
+
+    auto &atlas = package.atlas_;
+    auto nSheets = reader.ReadUInt32();
+    for (std::uint32_t i = 0; i < nSheets && reader.IsGood(); i++) {
+        Shared::TextureAtlas::Sheet sheet;
+        sheet.name_ = reader.ReadString();
+        sheet.page_ = reader.ReadUInt32();
+        sheet.position_ = ReadVector2u(reader);
+        sheet.size_ = ReadVector2u(reader);
+        sheet.rectCount_ = ReadVector2u(reader);
+        atlas.sheets_.push_back(sheet);
+    }
+    auto nPages = reader.ReadUInt32();
+    for (std::uint32_t i = 0; i < nPages && reader.IsGood(); i++) {
+        auto size = ReadVector2u(reader);
+        std::vector<std::uint8_t> pixels(4 * size.x * size.y);
+        if (!reader.Read(pixels.data(), pixels.size())) break;
+        auto page = std::make_unique<Graphic::Image>();
+        page->create(size.x, size.y, pixels.data());
+        atlas.pages_.push_back(std::move(page));
+    }
+
+    if (!reader.IsGood()) {
+        LOG_WARN("%s is corrupt", DUMP(path));
+        return false;
+    }
+
+    return true;
+}
+
+}  // namespace World
+
+}  // namespace FA
@@ -0,0 +1,41 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "Resource/TextureAtlas.h"
+#include "TileMapData.h"
+
+namespace FA {
+
+namespace World {
+
+// Everything a level needs from disk, cooked offline so that loading skips TMX/TSX parsing and PNG decoding
+struct LevelPackage
+{
+    // A package is only read while its sources have the modification times they had when it was cooked
+    struct Source
+    {
+        std::string path_;
+        std::time_t modified_{};
+    };
+
+    std::vector<Source> sources_;
+    Tile::TileMapData tileMapData_;
+    Shared::TextureAtlas::Packed atlas_;
+};
+
+std::string GetLevelPackagePath(const std::string &levelName);
+bool WriteLevelPackage(const std::string &path, const LevelPackage &package);
+bool ReadLevelPackage(const std::string &path, LevelPackage &package);  // false when missing or stale
+
+}  // namespace World
+
+}  // namespace FA
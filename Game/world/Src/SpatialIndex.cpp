@@ -0,0 +1,73 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "SpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace FA {
+
+namespace World {
+
+SpatialIndex::SpatialIndex(float cellSize)
+    : cellSize_(cellSize)
+{}
+
+void SpatialIndex::Create(const sf::Vector2u &mapSize)
+{
+    nCols_ = std::max(1, static_cast<int>(std::ceil(mapSize.x / cellSize_)));
+    nRows_ = std::max(1, static_cast<int>(std::ceil(mapSize.y / cellSize_)));
+    cells_.assign(nCols_ * nRows_, {});
+    bounds_.clear();
+}
+
+void SpatialIndex::Add(std::size_t item, const sf::FloatRect &bounds)
+{
+    if (cells_.empty()) return;
+    if (item >= bounds_.size()) bounds_.resize(item + 1);
+    bounds_[item] = bounds;
+
+    for (int row = ToRow(bounds.top); row <= ToRow(bounds.top + bounds.height); row++) {
+        for (int col = ToCol(bounds.left); col <= ToCol(bounds.left + bounds.width); col++) {
+            cells_[row * nCols_ + col].push_back(item);
+        }
+    }
+}
+
+std::vector<std::size_t> SpatialIndex::Query(const sf::FloatRect &rect) const
+{
+    std::vector<std::size_t> result;
+    if (cells_.empty()) return result;
+
+    for (int row = ToRow(rect.top); row <= ToRow(rect.top + rect.height); row++) {
+        for (int col = ToCol(rect.left); col <= ToCol(rect.left + rect.width); col++) {
+            for (auto item : cells_[row * nCols_ + col]) {
+                if (bounds_[item].intersects(rect)) result.push_back(item);
+            }
+        }
+    }
+
+    // an item spanning several cells is found once per cell
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+
+    return result;
+}
+
+int SpatialIndex::ToCol(float x) const
+{
+    return std::min(std::max(0, static_cast<int>(std::floor(x / cellSize_))), nCols_ - 1);
+}
+
+int SpatialIndex::ToRow(float y) const
+{
+    return std::min(std::max(0, static_cast<int>(std::floor(y / cellSize_))), nRows_ - 1);
+}
+
+}  // namespace World
+
+}  // namespace FA
@@ -0,0 +1,42 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace FA {
+
+namespace World {
+
+// Uniform grid over the map for items that never move, e.g. tiles. Items are identified by index.
+class SpatialIndex
+{
+public:
+    SpatialIndex(float cellSize);
+
+    void Create(const sf::Vector2u &mapSize);
+    void Add(std::size_t item, const sf::FloatRect &bounds);
+    std::vector<std::size_t> Query(const sf::FloatRect &rect) const;  // ascending item order
+
+private:
+    const float cellSize_;
+    int nCols_{};
+    int nRows_{};
+    std::vector<std::vector<std::size_t>> cells_;
+    std::vector<sf::FloatRect> bounds_;
+
+private:
+    int ToCol(float x) const;
+    int ToRow(float y) const;
+};
+
+}  // namespace World
+
+}  // namespace FA
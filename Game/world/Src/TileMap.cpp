@@ -6,12 +6,12 @@
 
 #include "TileMap.h"
 
+#include <algorithm>
+#include <tuple>
+
 #include "Logging.h"
 #include "Resource/ImageData.h"
-#include "Resource/ResourceId.h"
-#include "Resource/SheetManager.h"
-#include "Resource/SpriteSheet.h"
-#include "Resource/TextureManager.h"
+#include "Resource/TextureAtlas.h"
 #include "TileMapData.h"
 #include "TileMapParser.h"
 
@@ -19,9 +19,20 @@ namespace FA {
 
 namespace World {
 
-TileMap::TileMap(Shared::TextureManager& textureManager, Shared::SheetManager& sheetManager)
-    : textureManager_(textureManager)
-    , sheetManager_(sheetManager)
+namespace {
+
+// Tiles in a layer are kept in the order they are drawn, row by row
+template <class Layer>
+auto FindTile(Layer& layer, const sf::Vector2u& cell) -> decltype(layer.begin())
+{
+    return std::lower_bound(layer.begin(), layer.end(), cell, [](const TileMap::TileData& data, const sf::Vector2u& c) {
+        return std::tie(data.cell_.y, data.cell_.x) < std::tie(c.y, c.x);
+    });
+}
+
+}  // namespace
+
+TileMap::TileMap()
 {
     tileMapParser_ = std::make_unique<Tile::TileMapParser>();
 }
@@ -31,7 +42,42 @@ TileMap::~TileMap() = default;
 void TileMap::Load(const std::string& fileName)
 {
     tileMapData_ = std::make_unique<Tile::TileMapData>(tileMapParser_->Run(fileName));
-    LoadTileSets();
+}
+
+void TileMap::Load(const Tile::TileMapData& tileMapData)
+{
+    tileMapData_ = std::make_unique<Tile::TileMapData>(tileMapData);
+}
+
+bool TileMap::Reload(const std::string& fileName, std::vector<std::string>& changedLayers)
+{
+    auto tileMapData = tileMapParser_->Run(fileName);
+    auto& layers = tileMapData_->layers_;
+    bool isSameLayers = tileMapData.layers_.size() == layers.size() &&
+                        std::equal(layers.begin(), layers.end(), tileMapData.layers_.begin(),
+                                   [](const Tile::TileMapData::Layer& lhs, const Tile::TileMapData::Layer& rhs) {
+                                       return lhs.name_ == rhs.name_;
+                                   });
+    // other tile sets need the atlas to be packed again
+    if (!(tileMapData.mapProperties_ == tileMapData_->mapProperties_) ||
+        !(tileMapData.tileSets_ == tileMapData_->tileSets_) || !isSameLayers) {
+        return false;
+    }
+    if (!(tileMapData.objectGroups_ == tileMapData_->objectGroups_)) {
+        LOG_WARN("Objects in %s changed, they are created from what was loaded", DUMP(fileName));
+    }
+
+    changedLayers.clear();
+    for (std::size_t i = 0; i < layers.size(); i++) {
+        if (layers[i] == tileMapData.layers_[i]) continue;
+
+        layers[i] = std::move(tileMapData.layers_[i]);
+        layers_[layers[i].name_].clear();
+        SetupLayer(i);
+        changedLayers.push_back(layers[i].name_);
+    }
+
+    return true;
 }
 
 void TileMap::Setup()
@@ -41,61 +87,20 @@ void TileMap::Setup()
     SetupEntityGroups();
 }
 
-void TileMap::LoadTileSets()
+void TileMap::AddTileSets(Shared::TextureAtlas& textureAtlas) const
 {
     for (auto& entry : tileMapData_->tileSets_) {
         auto images = entry.second.images_;
         for (const auto& image : images) {
-            Shared::ResourceId id = textureManager_.Load(image.path_);
-            auto size = textureManager_.Get(id)->getSize();
-            auto sheet = std::make_unique<Shared::SpriteSheet>(id, size, sf::Vector2u(image.nCols_, image.nRows_));
-            sheetManager_.AddSheet(image.path_, std::move(sheet));
+            textureAtlas.Add(image.path_, image.path_, sf::Vector2u(image.nCols_, image.nRows_));
         }
     }
 }
 
 void TileMap::SetupLayers()
 {
-    auto nCols = tileMapData_->mapProperties_.width_;
-    auto tileWidth = tileMapData_->mapProperties_.tileWidth_;
-    auto tileHeight = tileMapData_->mapProperties_.tileHeight_;
-
-    for (const auto& layer : tileMapData_->layers_) {
-        int inx = 0;
-        auto layerName = layer.name_;
-        for (auto it = layer.tileIds_.begin(); layer.tileIds_.end() != it; ++it, ++inx) {
-            auto tileId = *it;
-            if (tileId == 0) continue;
-            auto tileData = LookupTileData(tileId);
-            TileMap::TileData outData;
-            unsigned int x = (inx % nCols) * tileWidth;
-            unsigned int y = (inx / nCols) * tileHeight;
-
-            if (!tileData.animation_.empty()) {
-                auto first = tileData.animation_.at(0);
-                if (first.height_ > tileHeight) {
-                    y += tileHeight;
-                    y -= first.height_;
-                }
-            }
-
-            outData.position_ = sf::Vector2f(static_cast<float>(x), static_cast<float>(y));
-
-            if (!tileData.animation_.empty()) {
-                std::vector<Shared::ImageData> outAnimation;
-                for (auto frame : tileData.animation_) {
-                    Shared::ImageData data{{frame.texturePath_, {frame.column_, frame.row_}}};
-                    outAnimation.push_back(data);
-                }
-
-                outData.graphic_.animation_ = outAnimation;
-            }
-
-            Shared::ImageData data{{tileData.image_.texturePath_, {tileData.image_.column_, tileData.image_.row_}}};
-            outData.graphic_.image_ = data;
-
-            layers_[layerName].push_back(outData);
-        }
+    for (std::size_t i = 0; i < tileMapData_->layers_.size(); i++) {
+        SetupLayer(i);
     }
 }
 
@@ -138,18 +143,118 @@ sf::Vector2u TileMap::GetSize() const
     return size;
 }
 
-Tile::TileData TileMap::LookupTileData(int id)
+bool TileMap::SetTile(const std::string& layerName, const sf::Vector2u& cell, int tileId)
+{
+    auto nCols = tileMapData_->mapProperties_.width_;
+    auto nRows = tileMapData_->mapProperties_.height_;
+    auto& layers = tileMapData_->layers_;
+    auto layerIt = std::find_if(layers.begin(), layers.end(),
+                                [&layerName](const Tile::TileMapData::Layer& layer) { return layer.name_ == layerName; });
+    if (layerIt == layers.end() || cell.x >= nCols || cell.y >= nRows) return false;
+
+    const Tile::TileData* tileData = nullptr;
+    if (tileId != 0) {
+        tileData = LookupTileData(tileId);
+        if (tileData == nullptr) return false;
+    }
+
+    auto inx = cell.y * nCols + cell.x;
+    layerIt->tileIds_.at(inx) = tileId;
+    auto& layer = layers_[layerName];
+    auto it = FindTile(layer, cell);
+    bool isFound = it != layer.end() && it->cell_ == cell;
+    if (tileId == 0) {
+        if (isFound) layer.erase(it);
+    }
+    else if (isFound) {
+        *it = CreateTileData(inx, *tileData);
+    }
+    else {
+        layer.insert(it, CreateTileData(inx, *tileData));
+    }
+
+    return true;
+}
+
+const TileMap::TileData* TileMap::GetTile(const std::string& layerName, const sf::Vector2u& cell) const
+{
+    auto layerIt = layers_.find(layerName);
+    if (layerIt == layers_.end()) return nullptr;
+
+    const auto& layer = layerIt->second;
+    auto it = FindTile(layer, cell);
+    return it != layer.end() && it->cell_ == cell ? &*it : nullptr;
+}
+
+sf::Vector2u TileMap::GetTileSize() const
+{
+    return {tileMapData_->mapProperties_.tileWidth_, tileMapData_->mapProperties_.tileHeight_};
+}
+
+void TileMap::SetupLayer(std::size_t index)
+{
+    const auto& layer = tileMapData_->layers_[index];
+    auto& outLayer = layers_[layer.name_];
+    unsigned int inx = 0;
+    for (auto it = layer.tileIds_.begin(); layer.tileIds_.end() != it; ++it, ++inx) {
+        auto tileId = *it;
+        if (tileId == 0) continue;
+        const auto* tileData = LookupTileData(tileId);
+        if (tileData == nullptr) continue;
+        outLayer.push_back(CreateTileData(inx, *tileData));
+    }
+}
+
+TileMap::TileData TileMap::CreateTileData(unsigned int inx, const Tile::TileData& tileData)
+{
+    auto nCols = tileMapData_->mapProperties_.width_;
+    auto tileWidth = tileMapData_->mapProperties_.tileWidth_;
+    auto tileHeight = tileMapData_->mapProperties_.tileHeight_;
+    TileMap::TileData outData;
+    outData.cell_ = sf::Vector2u(inx % nCols, inx / nCols);
+    unsigned int x = outData.cell_.x * tileWidth;
+    unsigned int y = outData.cell_.y * tileHeight;
+
+    if (!tileData.animation_.empty()) {
+        auto first = tileData.animation_.at(0);
+        if (first.height_ > tileHeight) {
+            y += tileHeight;
+            y -= first.height_;
+        }
+    }
+
+    outData.position_ = sf::Vector2f(static_cast<float>(x), static_cast<float>(y));
+
+    if (!tileData.animation_.empty()) {
+        std::vector<Shared::ImageData> outAnimation;
+        for (auto frame : tileData.animation_) {
+            Shared::ImageData data{{frame.texturePath_, {frame.column_, frame.row_}}};
+            outAnimation.push_back(data);
+        }
+
+        outData.graphic_.animation_ = outAnimation;
+    }
+
+    Shared::ImageData data{{tileData.image_.texturePath_, {tileData.image_.column_, tileData.image_.row_}}};
+    outData.graphic_.image_ = data;
+
+    return outData;
+}
+
+// Ids beyond the last tile of a tile set are not in it, find keeps them from being added
+const Tile::TileData* TileMap::LookupTileData(int id) const
 {
     auto it = tileMapData_->tileSets_.lower_bound(id);
 
     if (it != tileMapData_->tileSets_.end()) {
         auto firstGid = it->first;
-        return it->second.lookupTable_[id - firstGid];
-    }
-    else {
-        LOG_ERROR("%s not found", DUMP(id));
-        return {};
+        const auto& lookupTable = it->second.lookupTable_;
+        auto tileIt = lookupTable.find(id - firstGid);
+        if (tileIt != lookupTable.end()) return &tileIt->second;
     }
+
+    LOG_ERROR("%s not found", DUMP(id));
+    return nullptr;
 }
 
 }  // namespace World
@@ -15,14 +15,13 @@
 #include <SFML/System/Vector2.hpp>
 
 #include "Resource/EntityData.h"
-#include "Resource/TextureManager.h"
 #include "Resource/TileGraphic.h"
 
 namespace FA {
 
 namespace Shared {
 
-class SheetManager;
+class TextureAtlas;
 
 }  // namespace Shared
 
@@ -43,30 +42,39 @@ public:
     {
         sf::Vector2f position_{};
         Shared::TileGraphic graphic_{};
+        sf::Vector2u cell_{};  // column, row
     };
 
 public:
-    TileMap(Shared::TextureManager &textureManager, Shared::SheetManager &sheetManager);
+    TileMap();
     ~TileMap();
     void Load(const std::string &fileName);
-    void Setup();
+    void Load(const Tile::TileMapData &tileMapData);
+    // Parses the file again and sets up the layers that differ. Fails when more than the tiles of layers changed.
+    bool Reload(const std::string &fileName, std::vector<std::string> &changedLayers);
+    void AddTileSets(Shared::TextureAtlas &textureAtlas) const;
+    void Setup();  // both setup stages
+    void SetupLayers();
+    void SetupEntityGroups();
+    const Tile::TileMapData &GetData() const { return *tileMapData_; }
     const std::vector<TileData> GetLayer(const std::string &name) const;
+    // 0 clears the tile, fails for ids that are in no tile set
+    bool SetTile(const std::string &layerName, const sf::Vector2u &cell, int tileId);
+    const TileData *GetTile(const std::string &layerName, const sf::Vector2u &cell) const;
     const std::vector<Shared::EntityData> GetEntityGroup(const std::string &name) const;
     sf::Vector2u GetSize() const;
+    sf::Vector2u GetTileSize() const;
 
 private:
-    Shared::TextureManager &textureManager_;
-    Shared::SheetManager &sheetManager_;
     std::unique_ptr<Tile::TileMapData> tileMapData_ = nullptr;
     std::unique_ptr<Tile::TileMapParser> tileMapParser_ = nullptr;
     std::map<std::string, std::vector<TileData>> layers_;
     std::map<std::string, std::vector<Shared::EntityData>> entityGroups_;
 
 private:
-    void LoadTileSets();
-    void SetupLayers();
-    void SetupEntityGroups();
-    Tile::TileData LookupTileData(int id);
+    void SetupLayer(std::size_t index);
+    TileData CreateTileData(unsigned int inx, const Tile::TileData &tileData);
+    const Tile::TileData *LookupTileData(int id) const;
 };
 
 }  // namespace World
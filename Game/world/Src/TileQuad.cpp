@@ -0,0 +1,48 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "TileQuad.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include "VertexArrayIf.h"
+
+namespace FA {
+
+namespace World {
+
+void AddTileQuad(Graphic::VertexArrayIf &vertexArray, const sf::Vector2f &position, const sf::IntRect &textureRect)
+{
+    auto index = vertexArray.getVertexCount();
+    vertexArray.resize(index + verticesPerTileQuad);
+    SetTileQuad(vertexArray, index, position, textureRect);
+}
+
+void SetTileQuad(Graphic::VertexArrayIf &vertexArray, std::size_t index, const sf::Vector2f &position,
+                 const sf::IntRect &textureRect)
+{
+    float width = static_cast<float>(textureRect.width);
+    float height = static_cast<float>(textureRect.height);
+    float left = static_cast<float>(textureRect.left);
+    float top = static_cast<float>(textureRect.top);
+
+    sf::Vertex topLeft(position, {left, top});
+    sf::Vertex topRight(position + sf::Vector2f(width, 0.0f), {left + width, top});
+    sf::Vertex bottomLeft(position + sf::Vector2f(0.0f, height), {left, top + height});
+    sf::Vertex bottomRight(position + sf::Vector2f(width, height), {left + width, top + height});
+
+    vertexArray[index] = topLeft;
+    vertexArray[index + 1] = topRight;
+    vertexArray[index + 2] = bottomRight;
+    vertexArray[index + 3] = topLeft;
+    vertexArray[index + 4] = bottomRight;
+    vertexArray[index + 5] = bottomLeft;
+}
+
+}  // namespace World
+
+}  // namespace FA
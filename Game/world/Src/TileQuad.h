@@ -0,0 +1,32 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "SfmlFwd.h"
+
+namespace FA {
+
+namespace Graphic {
+
+class VertexArrayIf;
+
+}  // namespace Graphic
+
+namespace World {
+
+constexpr std::size_t verticesPerTileQuad = 6;
+
+void AddTileQuad(Graphic::VertexArrayIf &vertexArray, const sf::Vector2f &position, const sf::IntRect &textureRect);
+// Overwrite the quad starting at vertex index, as added by AddTileQuad
+void SetTileQuad(Graphic::VertexArrayIf &vertexArray, std::size_t index, const sf::Vector2f &position,
+                 const sf::IntRect &textureRect);
+
+}  // namespace World
+
+}  // namespace FA
@@ -0,0 +1,155 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "StressScene.h"
+
+#include <random>
+
+#include "Folder.h"
+#include "Logging.h"
+#include "RecordingRenderTarget.h"
+#include "Resource/EntityData.h"
+#include "Screen.h"
+#include "TileMapData.h"
+
+namespace FA {
+
+namespace World {
+
+namespace {
+
+constexpr float deltaTime = 1.0f / 60.0f;
+constexpr unsigned int mapWidth = 100;
+constexpr unsigned int mapHeight = 100;
+constexpr unsigned int tileSize = 16;
+
+// tileset.png is a 34x32 grid of 16x16 tiles
+constexpr unsigned int tileSetCols = 34;
+constexpr unsigned int tileSetRows = 32;
+constexpr int tileSetFirstGid = 1;
+constexpr int animatedFirstGid = tileSetFirstGid + tileSetCols * tileSetRows;
+constexpr unsigned int nAnimatedTiles = 4;
+constexpr unsigned int nAnimationFrames = 4;
+
+const char* faceDirections[] = {"Front", "Back", "Left", "Right"};
+
+Tile::TileMapData CreateTileMapData(std::mt19937 &engine)
+{
+    Tile::TileMapData data;
+    data.mapProperties_ = {mapWidth, mapHeight, tileSize, tileSize};
+
+    auto path = Util::GetAssetsPath() + "/tiny-RPG-forest-files/PNG/environment/tileset.png";
+    Tile::TileSetData gridTileSet;
+    gridTileSet.images_.push_back({path, tileSetCols, tileSetRows});
+    for (unsigned int id = 0; id < tileSetCols * tileSetRows; id++) {
+        Tile::Frame frame{path, id % tileSetCols, id / tileSetCols, tileSize, tileSize};
+        gridTileSet.lookupTable_[id] = Tile::TileData{frame, {}};
+    }
+    data.tileSets_[tileSetFirstGid] = gridTileSet;
+
+    Tile::TileSetData animatedTileSet;
+    for (unsigned int id = 0; id < nAnimatedTiles; id++) {
+        std::vector<Tile::Frame> animation;
+        for (unsigned int f = 0; f < nAnimationFrames; f++) {
+            animation.push_back({path, f, id, tileSize, tileSize});
+        }
+        animatedTileSet.lookupTable_[id] = Tile::TileData{animation.front(), animation};
+    }
+    data.tileSets_[animatedFirstGid] = animatedTileSet;
+
+    std::uniform_int_distribution<int> groundDist(tileSetFirstGid, animatedFirstGid - 1);
+    std::uniform_int_distribution<int> animatedDist(animatedFirstGid, animatedFirstGid + nAnimatedTiles - 1);
+    std::uniform_real_distribution<float> coverage(0.0f, 1.0f);
+    auto createLayer = [&](const std::string &name, float density, std::uniform_int_distribution<int> &dist) {
+        Tile::TileMapData::Layer layer{name, {}};
+        for (unsigned int i = 0; i < mapWidth * mapHeight; i++) {
+            layer.tileIds_.push_back(coverage(engine) < density ? dist(engine) : 0);
+        }
+        return layer;
+    };
+
+    // layer names are the ones Level expects
+    data.layers_.push_back(createLayer("Ground Layer 1", 1.0f, groundDist));
+    data.layers_.push_back(createLayer("Ground Layer 2", 0.2f, groundDist));
+    data.layers_.push_back(createLayer("Dynamic Layer 1", 0.02f, animatedDist));
+    data.layers_.push_back(createLayer("Fringe Layer", 0.1f, groundDist));
+    data.objectGroups_.push_back({"Object Layer 1", {}});
+    data.objectGroups_.push_back({"Collision Layer 1", {}});
+
+    return data;
+}
+
+}  // namespace
+
+StressScene::StressScene(Shared::TextureManager &textureManager, unsigned int nEntities)
+    : nEntities_(nEntities)
+{
+    std::mt19937 engine(nEntities);
+    sf::Vector2u viewSize(Shared::Screen::width, Shared::Screen::height);
+    level_ = std::make_unique<Level>(messageBus_, textureManager, viewSize);
+    level_->Load(CreateTileMapData(engine));
+    level_->Create();
+}
+
+StressScene::~StressScene() = default;
+
+// Phases are timed by the profile scopes of the level, so the libraries must be built with FA_PROFILER
+StressScene::Result StressScene::Run(unsigned int nFrames)
+{
+    LOG_INFO("Run %u frames with %u entities", nFrames, nEntities_);
+    Result result;
+    result.nEntities_ = nEntities_;
+    result.nFrames_ = nFrames;
+    // arrows leave the map and are destroyed, keep creation and deletion pools busy during the run
+    unsigned int nSpawnPerFrame = std::max(1u, nEntities_ / 100);
+    Graphic::RecordingRenderTarget renderTarget;
+    if (nFrames < Util::Profiler::nFrames) LOG_WARN("Stats include frames from before the run");
+
+    SpawnEntities(nEntities_);
+    for (unsigned int frame = 0; frame < nFrames; frame++) {
+        if (frame > 0) SpawnEntities(nSpawnPerFrame);
+        level_->Update(deltaTime);
+        renderTarget.Clear();
+        level_->Draw(renderTarget);
+        result.nDrawCalls_ = static_cast<unsigned int>(renderTarget.GetNumberOfDrawCalls());
+        auto nBatches = renderTarget.GetNumberOfDrawCalls(Graphic::RecordingRenderTarget::CommandType::Batch);
+        result.nBatches_ = static_cast<unsigned int>(nBatches);
+        PROFILE_END_FRAME();
+    }
+
+    const auto &profiler = Util::Profiler::Instance();
+    result.creationPool_ = profiler.GetStats("Level::CreationPool");
+    result.animation_ = profiler.GetStats("Level::Animation");
+    result.entityUpdate_ = profiler.GetStats("EntityHandler::Update");
+    result.collision_ = profiler.GetStats("Level::Collision");
+    result.deletionPool_ = profiler.GetStats("Level::DeletionPool");
+    result.drawList_ = profiler.GetStats("Level::Draw");
+    if (nFrames > 0 && result.drawList_.nFrames_ == 0) LOG_WARN("No profiler samples, build with FA_PROFILER=1");
+
+    return result;
+}
+
+void StressScene::SpawnEntities(unsigned int nEntities)
+{
+    std::mt19937 engine(objId_);
+    std::uniform_int_distribution<int> xDist(0, mapWidth * tileSize - 1);
+    std::uniform_int_distribution<int> yDist(0, mapHeight * tileSize - 1);
+    std::uniform_int_distribution<int> dirDist(0, 3);
+
+    for (unsigned int i = 0; i < nEntities; i++) {
+        Shared::EntityData data;
+        data.objId_ = ++objId_;
+        data.typeStr_ = (objId_ % 2) == 0 ? "Mole" : "Arrow";
+        data.position_ = sf::Vector2f(static_cast<float>(xDist(engine)), static_cast<float>(yDist(engine)));
+        data.size_ = sf::Vector2f(static_cast<float>(tileSize), static_cast<float>(tileSize));
+        data.properties_["FaceDirection"] = faceDirections[dirDist(engine)];
+        level_->AddEntity(data);
+    }
+}
+
+}  // namespace World
+
+}  // namespace FA
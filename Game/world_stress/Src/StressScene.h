@@ -0,0 +1,56 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "Level.h"
+#include "Message/MessageBus.h"
+#include "Profiler.h"
+#include "Resource/TextureManager.h"
+
+namespace FA {
+
+namespace World {
+
+class StressScene
+{
+public:
+    struct Result
+    {
+        unsigned int nEntities_{};
+        unsigned int nFrames_{};
+        // profiler stats of the last frames of the run, at most Util::Profiler::nFrames
+        Util::Profiler::Stats creationPool_{};
+        Util::Profiler::Stats animation_{};
+        Util::Profiler::Stats entityUpdate_{};
+        Util::Profiler::Stats collision_{};
+        Util::Profiler::Stats deletionPool_{};
+        Util::Profiler::Stats drawList_{};
+        unsigned int nDrawCalls_{};  // last frame
+        unsigned int nBatches_{};    // last frame, sprite batches among the draw calls
+    };
+
+public:
+    StressScene(Shared::TextureManager &textureManager, unsigned int nEntities);
+    ~StressScene();
+
+    Result Run(unsigned int nFrames);
+
+private:
+    Shared::MessageBus messageBus_;
+    std::unique_ptr<Level> level_;
+    unsigned int nEntities_{};
+    int objId_{};
+
+private:
+    void SpawnEntities(unsigned int nEntities);
+};
+
+}  // namespace World
+
+}  // namespace FA
@@ -0,0 +1,60 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Logging.h"
+#include "Resource/TextureManager.h"
+#include "StressScene.h"
+
+namespace {
+
+const unsigned int defaultFrames = 600;
+const std::vector<unsigned int> defaultEntityCounts = {100, 500, 1000, 2000, 5000};
+
+}  // namespace
+
+// usage: world_stress [frames] [entity count]...
+// run from the folder containing assets, prints average milliseconds per frame and phase as csv
+int main(int argc, char* argv[])
+{
+    using namespace FA;
+
+    unsigned int nFrames = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : defaultFrames;
+    std::vector<unsigned int> entityCounts;
+    for (int i = 2; i < argc; i++) {
+        entityCounts.push_back(std::strtoul(argv[i], nullptr, 10));
+    }
+    if (entityCounts.empty()) entityCounts = defaultEntityCounts;
+
+    auto createFn = []() { return std::make_unique<Graphic::Texture>(); };
+    Shared::TextureManager textureManager(createFn);
+
+    std::cout << "entities,frames,creation_pool_ms,animation_ms,entity_update_ms,collision_ms,deletion_pool_ms,"
+                 "draw_list_ms,draw_calls,batches"
+              << std::endl;
+
+    try {
+        for (auto nEntities : entityCounts) {
+            World::StressScene scene(textureManager, nEntities);
+            auto r = scene.Run(nFrames);
+            std::cout << r.nEntities_ << "," << r.nFrames_ << "," << r.creationPool_.avg_ << ","
+                      << r.animation_.avg_ << "," << r.entityUpdate_.avg_ << "," << r.collision_.avg_ << ","
+                      << r.deletionPool_.avg_ << "," << r.drawList_.avg_ << "," << r.nDrawCalls_ << ","
+                      << r.nBatches_ << std::endl;
+        }
+    }
+    catch (const std::exception& e) {
+        LOG_ERROR("Exception catched: %s", e.what());
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
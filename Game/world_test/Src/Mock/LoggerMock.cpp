@@ -0,0 +1,28 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include "Mock/LoggerMock.h"
+
+namespace FA {
+
+namespace World {
+
+Util::LoggerIf* LoggerMock::proxy_;
+
+}  // namespace World
+
+namespace Shared {
+
+// Implementation must be in a cpp file, so it can be substituted during link time
+// for mocking purpose
+Util::LoggerIf& Logger()
+{
+    return World::LoggerMock::Proxy();
+}
+
+}  // namespace Shared
+
+}  // namespace FA
@@ -0,0 +1,135 @@
+/*
+ *	Copyright (C) 2024 Anders Wennmo
+ *	This file is part of forestadventure which is released under MIT license.
+ *	See file LICENSE for full license details.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Mock/LoggerMock.h"
+#include "TileMap.h"
+#include "TileMapData.h"
+
+using namespace testing;
+
+namespace FA {
+
+namespace World {
+
+class TileMapTest : public testing::Test
+{
+protected:
+    TileMapTest()
+    {
+        Tile::TileMapData data;
+        data.mapProperties_ = {3, 2, 16, 16};
+        Tile::TileData tile1{{"tiles.png", 0, 0, 16, 16}, {}};
+        Tile::TileData tile2{{"tiles.png", 1, 0, 16, 16}, {}};
+        data.tileSets_[1] = {{{"tiles.png", 2, 1}}, {{0, tile1}, {1, tile2}}};
+        data.layers_ = {{"ground", {1, 0, 0, 0, 0, 2}}};
+        tileMap_.Load(data);
+        tileMap_.SetupLayers();
+    }
+
+    TileMap tileMap_;
+    StrictMock<LoggerMock> loggerMock_;
+};
+
+TEST_F(TileMapTest, GetTileShouldReturnTileOfCell)
+{
+    const auto* tile = tileMap_.GetTile("ground", {2, 1});
+    ASSERT_THAT(tile, NotNull());
+    EXPECT_THAT(tile->cell_, Eq(sf::Vector2u(2, 1)));
+    EXPECT_THAT(tile->position_, Eq(sf::Vector2f(32.0f, 16.0f)));
+    Shared::ImageData expected{{"tiles.png", {1, 0}}};
+    EXPECT_THAT(tile->graphic_.image_, Eq(expected));
+}
+
+TEST_F(TileMapTest, GetTileShouldReturnNullForEmptyCell)
+{
+    EXPECT_THAT(tileMap_.GetTile("ground", {1, 0}), IsNull());
+}
+
+TEST_F(TileMapTest, GetTileShouldReturnNullForUnknownLayer)
+{
+    EXPECT_THAT(tileMap_.GetTile("water", {0, 0}), IsNull());
+}
+
+TEST_F(TileMapTest, SetTileShouldAddTileToEmptyCell)
+{
+    EXPECT_TRUE(tileMap_.SetTile("ground", {1, 0}, 2));
+
+    const auto* tile = tileMap_.GetTile("ground", {1, 0});
+    ASSERT_THAT(tile, NotNull());
+    EXPECT_THAT(tile->position_, Eq(sf::Vector2f(16.0f, 0.0f)));
+    Shared::ImageData expected{{"tiles.png", {1, 0}}};
+    EXPECT_THAT(tile->graphic_.image_, Eq(expected));
+    EXPECT_THAT(tileMap_.GetData().layers_[0].tileIds_, ElementsAre(1, 2, 0, 0, 0, 2));
+
+    auto layer = tileMap_.GetLayer("ground");
+    ASSERT_THAT(layer.size(), Eq(3u));
+    EXPECT_THAT(layer[0].cell_, Eq(sf::Vector2u(0, 0)));
+    EXPECT_THAT(layer[1].cell_, Eq(sf::Vector2u(1, 0)));
+    EXPECT_THAT(layer[2].cell_, Eq(sf::Vector2u(2, 1)));
+}
+
+TEST_F(TileMapTest, SetTileShouldReplaceTile)
+{
+    EXPECT_TRUE(tileMap_.SetTile("ground", {0, 0}, 2));
+
+    const auto* tile = tileMap_.GetTile("ground", {0, 0});
+    ASSERT_THAT(tile, NotNull());
+    Shared::ImageData expected{{"tiles.png", {1, 0}}};
+    EXPECT_THAT(tile->graphic_.image_, Eq(expected));
+    EXPECT_THAT(tileMap_.GetLayer("ground").size(), Eq(2u));
+    EXPECT_THAT(tileMap_.GetData().layers_[0].tileIds_, ElementsAre(2, 0, 0, 0, 0, 2));
+}
+
+TEST_F(TileMapTest, SetTileWithZeroShouldClearTile)
+{
+    EXPECT_TRUE(tileMap_.SetTile("ground", {0, 0}, 0));
+
+    EXPECT_THAT(tileMap_.GetTile("ground", {0, 0}), IsNull());
+    EXPECT_THAT(tileMap_.GetLayer("ground").size(), Eq(1u));
+    EXPECT_THAT(tileMap_.GetData().layers_[0].tileIds_, ElementsAre(0, 0, 0, 0, 0, 2));
+}
+
+TEST_F(TileMapTest, SetTileWithZeroShouldAcceptEmptyCell)
+{
+    EXPECT_TRUE(tileMap_.SetTile("ground", {1, 0}, 0));
+
+    EXPECT_THAT(tileMap_.GetLayer("ground").size(), Eq(2u));
+}
+
+TEST_F(TileMapTest, SetTileShouldFailForUnknownId)
+{
+    EXPECT_CALL(loggerMock_, MakeErrorLogEntry(ContainsRegex("id.*3.*not found")));
+    EXPECT_FALSE(tileMap_.SetTile("ground", {0, 0}, 3));
+
+    const auto* tile = tileMap_.GetTile("ground", {0, 0});
+    ASSERT_THAT(tile, NotNull());
+    Shared::ImageData expected{{"tiles.png", {0, 0}}};
+    EXPECT_THAT(tile->graphic_.image_, Eq(expected));
+    EXPECT_THAT(tileMap_.GetData().layers_[0].tileIds_, ElementsAre(1, 0, 0, 0, 0, 2));
+}
+
+TEST_F(TileMapTest, SetTileShouldFailForCellOutsideMap)
+{
+    EXPECT_FALSE(tileMap_.SetTile("ground", {3, 0}, 1));
+    EXPECT_FALSE(tileMap_.SetTile("ground", {0, 2}, 1));
+
+    EXPECT_THAT(tileMap_.GetLayer("ground").size(), Eq(2u));
+    EXPECT_THAT(tileMap_.GetData().layers_[0].tileIds_, ElementsAre(1, 0, 0, 0, 0, 2));
+}
+
+TEST_F(TileMapTest, SetTileShouldFailForUnknownLayer)
+{
+    EXPECT_FALSE(tileMap_.SetTile("water", {0, 0}, 1));
+
+    EXPECT_THAT(tileMap_.GetTile("water", {0, 0}), IsNull());
+}
+
+}  // namespace World
+
+}  // namespace FA